@@ -0,0 +1,267 @@
+package main
+
+// cathys-sensor-assets pre-renders every Round_Button used by cathys-sensor, in
+// each of its enabled, disabled, and touched states, into run-length encoded
+// RGB565 bitmaps, and emits them as a C++ header compiled into flash:
+//
+//   go run main.go ../cathys-sensor/button-bitmaps.h
+//
+// the button table and colors below must be kept in sync with the definitions
+// in sensor-display.h. rendering mimics ILI9341_t3: fillRoundRect for the
+// frame, then the built-in 5x7 font scaled by the text size, centered.
+
+import (
+	"bufio"
+	"fmt"
+	"io"
+	"log"
+	"os"
+	"strings"
+)
+
+// ILI9341 RGB565 color definitions (ILI9341_t3.h)
+const (
+	colorBlack    uint16 = 0x0000
+	colorNavy     uint16 = 0x000F
+	colorMaroon   uint16 = 0x7800
+	colorDarkGrey uint16 = 0x7BEF
+	colorRed      uint16 = 0xF800
+	colorCyan     uint16 = 0x07FF
+	colorYellow   uint16 = 0xFFE0
+	colorWhite    uint16 = 0xFFFF
+)
+
+const (
+	backgroundColor = colorBlack // GFX_BACKGROUND_COLOR
+	buttonTextSize  = 2          // GFX_BUTTON_TEXT_SIZE
+	glyphWidth      = 5
+	glyphHeight     = 8
+	glyphAdvance    = glyphWidth + 1
+)
+
+// button states, ordinal values must match Button_State in sensor-display.h
+const (
+	stateEnabled = iota
+	stateDisabled
+	stateTouched
+	stateCount
+)
+
+var stateName = []string{"Enabled", "Disabled", "Touched"}
+
+type colorPair struct {
+	fg, bg uint16
+}
+
+type button struct {
+	name   string // identifier used in generated symbols
+	text   string
+	width  int
+	height int
+	radius int
+	colors [stateCount]colorPair
+}
+
+var (
+	// GFX_BUTTON_* colors
+	buttonColors = [stateCount]colorPair{
+		{fg: colorNavy, bg: colorCyan},
+		{fg: colorWhite, bg: colorDarkGrey},
+		{fg: colorCyan, bg: colorNavy},
+	}
+	// GFX_CRITICAL_* colors
+	criticalColors = [stateCount]colorPair{
+		{fg: colorYellow, bg: colorMaroon},
+		{fg: colorWhite, bg: colorDarkGrey},
+		{fg: colorRed, bg: colorYellow},
+	}
+)
+
+// ordered the same as User_Command (ucmdPassive .. ucmdOff)
+var buttons = []button{
+	{"passive", "Pasv", 76, 36, 5, buttonColors},
+	{"safe", "Safe", 76, 36, 5, buttonColors},
+	{"track", "Track", 76, 36, 5, buttonColors},
+	{"full", "Full", 76, 36, 5, buttonColors},
+	{"reset", "Reset", 76, 36, 5, criticalColors},
+	{"off", "Off", 76, 36, 5, criticalColors},
+}
+
+// column-major glyphs (LSB is the top row) of the classic 5x7 GFX font, only
+// for those characters that appear on a button label.
+var glyph = map[rune][glyphWidth]byte{
+	'F': {0x7F, 0x09, 0x09, 0x09, 0x01},
+	'O': {0x3E, 0x41, 0x41, 0x41, 0x3E},
+	'P': {0x7F, 0x09, 0x09, 0x09, 0x06},
+	'R': {0x7F, 0x09, 0x19, 0x29, 0x46},
+	'S': {0x26, 0x49, 0x49, 0x49, 0x32},
+	'T': {0x03, 0x01, 0x7F, 0x01, 0x03},
+	'a': {0x20, 0x54, 0x54, 0x78, 0x40},
+	'c': {0x38, 0x44, 0x44, 0x44, 0x28},
+	'e': {0x38, 0x54, 0x54, 0x54, 0x18},
+	'f': {0x08, 0x7E, 0x09, 0x09, 0x02},
+	'k': {0x7F, 0x10, 0x28, 0x44, 0x00},
+	'l': {0x00, 0x41, 0x7F, 0x40, 0x00},
+	'r': {0x7C, 0x08, 0x04, 0x04, 0x08},
+	's': {0x48, 0x54, 0x54, 0x54, 0x24},
+	't': {0x04, 0x04, 0x3F, 0x44, 0x24},
+	'u': {0x3C, 0x40, 0x40, 0x20, 0x7C},
+	'v': {0x1C, 0x20, 0x40, 0x20, 0x1C},
+}
+
+type bitmap struct {
+	width, height int
+	pixel         []uint16
+}
+
+func render(b *button, c colorPair) *bitmap {
+	bmp := &bitmap{width: b.width, height: b.height, pixel: make([]uint16, b.width*b.height)}
+	// rounded frame: everything outside a corner circle is background
+	r := b.radius
+	for y := 0; y < b.height; y++ {
+		for x := 0; x < b.width; x++ {
+			cx, cy := x, y
+			if x < r {
+				cx = r
+			} else if x >= b.width-r {
+				cx = b.width - r - 1
+			}
+			if y < r {
+				cy = r
+			} else if y >= b.height-r {
+				cy = b.height - r - 1
+			}
+			dx, dy := x-cx, y-cy
+			if dx*dx+dy*dy <= r*r {
+				bmp.pixel[y*b.width+x] = c.bg
+			} else {
+				bmp.pixel[y*b.width+x] = backgroundColor
+			}
+		}
+	}
+	// centered label, scaled glyphs drawn without background
+	tw := len(b.text) * glyphAdvance * buttonTextSize
+	th := glyphHeight * buttonTextSize
+	ox := (b.width - tw) / 2
+	oy := (b.height - th) / 2
+	for i, ch := range b.text {
+		g, ok := glyph[ch]
+		if !ok {
+			log.Fatalf("no glyph for %q in button label %q", ch, b.text)
+		}
+		for col := 0; col < glyphWidth; col++ {
+			for row := 0; row < glyphHeight; row++ {
+				if 0 == g[col]&(1<<uint(row)) {
+					continue
+				}
+				for sy := 0; sy < buttonTextSize; sy++ {
+					for sx := 0; sx < buttonTextSize; sx++ {
+						x := ox + (i*glyphAdvance+col)*buttonTextSize + sx
+						y := oy + row*buttonTextSize + sy
+						if x >= 0 && x < b.width && y >= 0 && y < b.height {
+							bmp.pixel[y*b.width+x] = c.fg
+						}
+					}
+				}
+			}
+		}
+	}
+	return bmp
+}
+
+// encode produces (count, color) word pairs over the row-major pixel data.
+func encode(bmp *bitmap) []uint16 {
+	var rle []uint16
+	for i := 0; i < len(bmp.pixel); {
+		j := i + 1
+		for j < len(bmp.pixel) && bmp.pixel[j] == bmp.pixel[i] && j-i < 0xFFFF {
+			j++
+		}
+		rle = append(rle, uint16(j-i), bmp.pixel[i])
+		i = j
+	}
+	return rle
+}
+
+func symbol(b *button, state int) string {
+	return fmt.Sprintf("%sButton%sRLE", b.name, stateName[state])
+}
+
+func emit(w io.Writer) {
+	maxPixels := 0
+	fmt.Fprintln(w, "// -----------------------------------------------------------------------------")
+	fmt.Fprintln(w, "//")
+	fmt.Fprintln(w, "//  pre-rendered button bitmaps (RLE-compressed RGB565, stored in flash)")
+	fmt.Fprintln(w, "//")
+	fmt.Fprintln(w, "//  GENERATED by cathys-sensor-assets -- DO NOT EDIT")
+	fmt.Fprintln(w, "//")
+	fmt.Fprintln(w, "// -----------------------------------------------------------------------------")
+	fmt.Fprintln(w, "#if !defined(__BUTTON_BITMAPS_H__)")
+	fmt.Fprintln(w, "#define __BUTTON_BITMAPS_H__")
+	fmt.Fprintln(w)
+	fmt.Fprintln(w, "#include <Arduino.h>")
+	fmt.Fprintln(w)
+	for i := range buttons {
+		b := &buttons[i]
+		if n := b.width * b.height; n > maxPixels {
+			maxPixels = n
+		}
+		for s := 0; s < stateCount; s++ {
+			rle := encode(render(b, b.colors[s]))
+			fmt.Fprintf(w, "// %q %s: %dx%d, %d runs\n", b.text, strings.ToLower(stateName[s]), b.width, b.height, len(rle)/2)
+			fmt.Fprintf(w, "const uint16_t %s[%d] PROGMEM = {", symbol(b, s), len(rle))
+			for k, v := range rle {
+				if 0 == k%12 {
+					fmt.Fprint(w, "\n ")
+				}
+				fmt.Fprintf(w, " 0x%04X,", v)
+			}
+			fmt.Fprintln(w, "\n};")
+		}
+	}
+	fmt.Fprintln(w)
+	fmt.Fprintf(w, "#define NUM_BUTTON_BITMAP        %d\n", len(buttons))
+	fmt.Fprintf(w, "#define NUM_BUTTON_BITMAP_STATE  %d\n", stateCount)
+	fmt.Fprintf(w, "#define BUTTON_BITMAP_PIXELS_MAX %d\n", maxPixels)
+	fmt.Fprintln(w)
+	fmt.Fprintln(w, "typedef struct {")
+	fmt.Fprintln(w, "  int16_t         width;")
+	fmt.Fprintln(w, "  int16_t         height;")
+	fmt.Fprintln(w, "  size_t          length; // number of words in rle, two per run")
+	fmt.Fprintln(w, "  uint16_t const *rle;    // (count, color) pairs, row-major")
+	fmt.Fprintln(w, "} Button_Bitmap;")
+	fmt.Fprintln(w)
+	fmt.Fprintln(w, "// indexed by User_Command, then Button_State")
+	fmt.Fprintln(w, "const Button_Bitmap buttonBitmap[NUM_BUTTON_BITMAP][NUM_BUTTON_BITMAP_STATE] = {")
+	for i := range buttons {
+		b := &buttons[i]
+		fmt.Fprintln(w, "  {")
+		for s := 0; s < stateCount; s++ {
+			sym := symbol(b, s)
+			fmt.Fprintf(w, "    { %d, %d, sizeof(%s) / sizeof(*%s), %s },\n", b.width, b.height, sym, sym, sym)
+		}
+		fmt.Fprintln(w, "  },")
+	}
+	fmt.Fprintln(w, "};")
+	fmt.Fprintln(w)
+	fmt.Fprintln(w, "#endif // !defined(__BUTTON_BITMAPS_H__)")
+}
+
+func main() {
+
+	if len(os.Args) <= 1 {
+		log.Fatalf("usage:\n\t%s <output-header>", os.Args[0])
+	}
+
+	f, err := os.Create(os.Args[1])
+	if nil != err {
+		log.Fatalf("failed to create output file: %s: %s", os.Args[1], err)
+	}
+	defer f.Close()
+
+	w := bufio.NewWriter(f)
+	emit(w)
+	if err := w.Flush(); nil != err {
+		log.Fatalf("failed to write output file: %s: %s", os.Args[1], err)
+	}
+}
@@ -0,0 +1,581 @@
+// -----------------------------------------------------------------------------
+//
+//  pre-rendered button bitmaps (RLE-compressed RGB565, stored in flash)
+//
+//  GENERATED by cathys-sensor-assets -- DO NOT EDIT
+//
+// -----------------------------------------------------------------------------
+#if !defined(__BUTTON_BITMAPS_H__)
+#define __BUTTON_BITMAPS_H__
+
+#include <Arduino.h>
+
+// "Pasv" enabled: 76x36, 139 runs
+const uint16_t passiveButtonEnabledRLE[278] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x07FF, 0x0007, 0x0000, 0x0048, 0x07FF, 0x0003, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF, 0x0001, 0x0000, 0x018A, 0x07FF,
+  0x0008, 0x000F, 0x0044, 0x07FF, 0x0008, 0x000F, 0x0044, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0042, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0042, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF,
+  0x0008, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x001E, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF,
+  0x0008, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x001E, 0x07FF,
+  0x0008, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x001E, 0x07FF, 0x0008, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x001E, 0x07FF, 0x0002, 0x000F, 0x000C, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF,
+  0x0006, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x001E, 0x07FF,
+  0x0002, 0x000F, 0x000C, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x001E, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x000C, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0020, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x000C, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0020, 0x07FF, 0x0002, 0x000F, 0x000C, 0x07FF,
+  0x0008, 0x000F, 0x0002, 0x07FF, 0x0008, 0x000F, 0x0008, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF,
+  0x0002, 0x000F, 0x000C, 0x07FF, 0x0008, 0x000F, 0x0002, 0x07FF, 0x0008, 0x000F, 0x0008, 0x07FF,
+  0x0002, 0x000F, 0x0228, 0x07FF, 0x0001, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0003, 0x0000, 0x0048, 0x07FF, 0x0007, 0x0000, 0x0042, 0x07FF,
+  0x0005, 0x0000,
+};
+// "Pasv" disabled: 76x36, 139 runs
+const uint16_t passiveButtonDisabledRLE[278] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7BEF, 0x0007, 0x0000, 0x0048, 0x7BEF, 0x0003, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0001, 0x0000, 0x018A, 0x7BEF,
+  0x0008, 0xFFFF, 0x0044, 0x7BEF, 0x0008, 0xFFFF, 0x0044, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0042, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0042, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF,
+  0x0008, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x001E, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF,
+  0x0008, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x001E, 0x7BEF,
+  0x0008, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x001E, 0x7BEF, 0x0008, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x001E, 0x7BEF, 0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF,
+  0x0006, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x001E, 0x7BEF,
+  0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x001E, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0020, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0020, 0x7BEF, 0x0002, 0xFFFF, 0x000C, 0x7BEF,
+  0x0008, 0xFFFF, 0x0002, 0x7BEF, 0x0008, 0xFFFF, 0x0008, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF,
+  0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0008, 0xFFFF, 0x0002, 0x7BEF, 0x0008, 0xFFFF, 0x0008, 0x7BEF,
+  0x0002, 0xFFFF, 0x0228, 0x7BEF, 0x0001, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0003, 0x0000, 0x0048, 0x7BEF, 0x0007, 0x0000, 0x0042, 0x7BEF,
+  0x0005, 0x0000,
+};
+// "Pasv" touched: 76x36, 139 runs
+const uint16_t passiveButtonTouchedRLE[278] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x000F, 0x0007, 0x0000, 0x0048, 0x000F, 0x0003, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F, 0x0001, 0x0000, 0x018A, 0x000F,
+  0x0008, 0x07FF, 0x0044, 0x000F, 0x0008, 0x07FF, 0x0044, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0042, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0042, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F,
+  0x0008, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x001E, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F,
+  0x0008, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x001E, 0x000F,
+  0x0008, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x001E, 0x000F, 0x0008, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x001E, 0x000F, 0x0002, 0x07FF, 0x000C, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F,
+  0x0006, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x001E, 0x000F,
+  0x0002, 0x07FF, 0x000C, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x001E, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x000C, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0020, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x000C, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0020, 0x000F, 0x0002, 0x07FF, 0x000C, 0x000F,
+  0x0008, 0x07FF, 0x0002, 0x000F, 0x0008, 0x07FF, 0x0008, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F,
+  0x0002, 0x07FF, 0x000C, 0x000F, 0x0008, 0x07FF, 0x0002, 0x000F, 0x0008, 0x07FF, 0x0008, 0x000F,
+  0x0002, 0x07FF, 0x0228, 0x000F, 0x0001, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0003, 0x0000, 0x0048, 0x000F, 0x0007, 0x0000, 0x0042, 0x000F,
+  0x0005, 0x0000,
+};
+// "Safe" enabled: 76x36, 139 runs
+const uint16_t safeButtonEnabledRLE[278] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x07FF, 0x0007, 0x0000, 0x0048, 0x07FF, 0x0003, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF, 0x0001, 0x0000, 0x018C, 0x07FF,
+  0x0006, 0x000F, 0x0014, 0x07FF, 0x0004, 0x000F, 0x002E, 0x07FF, 0x0006, 0x000F, 0x0014, 0x07FF,
+  0x0004, 0x000F, 0x002C, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0010, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x002A, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0010, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x002A, 0x07FF,
+  0x0002, 0x000F, 0x000C, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0006, 0x000F, 0x0020, 0x07FF, 0x0002, 0x000F, 0x000C, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF,
+  0x0002, 0x000F, 0x000A, 0x07FF, 0x0006, 0x000F, 0x0022, 0x07FF, 0x0006, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0020, 0x07FF, 0x0006, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF,
+  0x0008, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0026, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0008, 0x07FF,
+  0x000A, 0x000F, 0x0026, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0008, 0x07FF, 0x000A, 0x000F, 0x001E, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0008, 0x07FF, 0x0002, 0x000F, 0x0026, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0008, 0x07FF, 0x0002, 0x000F, 0x0028, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF,
+  0x0008, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0006, 0x000F, 0x0022, 0x07FF,
+  0x0006, 0x000F, 0x0006, 0x07FF, 0x0008, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0006, 0x000F, 0x0226, 0x07FF, 0x0001, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0003, 0x0000, 0x0048, 0x07FF, 0x0007, 0x0000, 0x0042, 0x07FF,
+  0x0005, 0x0000,
+};
+// "Safe" disabled: 76x36, 139 runs
+const uint16_t safeButtonDisabledRLE[278] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7BEF, 0x0007, 0x0000, 0x0048, 0x7BEF, 0x0003, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0001, 0x0000, 0x018C, 0x7BEF,
+  0x0006, 0xFFFF, 0x0014, 0x7BEF, 0x0004, 0xFFFF, 0x002E, 0x7BEF, 0x0006, 0xFFFF, 0x0014, 0x7BEF,
+  0x0004, 0xFFFF, 0x002C, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0010, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x002A, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0010, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x002A, 0x7BEF,
+  0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0006, 0xFFFF, 0x0020, 0x7BEF, 0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0006, 0xFFFF, 0x0022, 0x7BEF, 0x0006, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0020, 0x7BEF, 0x0006, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0026, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0008, 0x7BEF,
+  0x000A, 0xFFFF, 0x0026, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0008, 0x7BEF, 0x000A, 0xFFFF, 0x001E, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0008, 0x7BEF, 0x0002, 0xFFFF, 0x0026, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0008, 0x7BEF, 0x0002, 0xFFFF, 0x0028, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF,
+  0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0006, 0xFFFF, 0x0022, 0x7BEF,
+  0x0006, 0xFFFF, 0x0006, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0006, 0xFFFF, 0x0226, 0x7BEF, 0x0001, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0003, 0x0000, 0x0048, 0x7BEF, 0x0007, 0x0000, 0x0042, 0x7BEF,
+  0x0005, 0x0000,
+};
+// "Safe" touched: 76x36, 139 runs
+const uint16_t safeButtonTouchedRLE[278] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x000F, 0x0007, 0x0000, 0x0048, 0x000F, 0x0003, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F, 0x0001, 0x0000, 0x018C, 0x000F,
+  0x0006, 0x07FF, 0x0014, 0x000F, 0x0004, 0x07FF, 0x002E, 0x000F, 0x0006, 0x07FF, 0x0014, 0x000F,
+  0x0004, 0x07FF, 0x002C, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0010, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x002A, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0010, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x002A, 0x000F,
+  0x0002, 0x07FF, 0x000C, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0006, 0x07FF, 0x0020, 0x000F, 0x0002, 0x07FF, 0x000C, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F,
+  0x0002, 0x07FF, 0x000A, 0x000F, 0x0006, 0x07FF, 0x0022, 0x000F, 0x0006, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0020, 0x000F, 0x0006, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F,
+  0x0008, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0026, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0008, 0x000F,
+  0x000A, 0x07FF, 0x0026, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0008, 0x000F, 0x000A, 0x07FF, 0x001E, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0008, 0x000F, 0x0002, 0x07FF, 0x0026, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0008, 0x000F, 0x0002, 0x07FF, 0x0028, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F,
+  0x0008, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0006, 0x07FF, 0x0022, 0x000F,
+  0x0006, 0x07FF, 0x0006, 0x000F, 0x0008, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0006, 0x07FF, 0x0226, 0x000F, 0x0001, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0003, 0x0000, 0x0048, 0x000F, 0x0007, 0x0000, 0x0042, 0x000F,
+  0x0005, 0x0000,
+};
+// "Track" enabled: 76x36, 183 runs
+const uint16_t trackButtonEnabledRLE[366] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x07FF, 0x0007, 0x0000, 0x0048, 0x07FF, 0x0003, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF, 0x0001, 0x0000, 0x0184, 0x07FF,
+  0x000A, 0x000F, 0x0026, 0x07FF, 0x0002, 0x000F, 0x001A, 0x07FF, 0x000A, 0x000F, 0x0026, 0x07FF,
+  0x0002, 0x000F, 0x001A, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF,
+  0x0002, 0x000F, 0x0026, 0x07FF, 0x0002, 0x000F, 0x001A, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0026, 0x07FF, 0x0002, 0x000F, 0x001E, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF,
+  0x0004, 0x000F, 0x0008, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0018, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF,
+  0x0004, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0018, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0004, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0008, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF,
+  0x0002, 0x000F, 0x001A, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0008, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x001A, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000C, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x000A, 0x07FF, 0x0004, 0x000F, 0x001C, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x000C, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0004, 0x000F, 0x001C, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x001A, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF,
+  0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x001A, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x000C, 0x07FF, 0x0008, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0018, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x000C, 0x07FF, 0x0008, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0220, 0x07FF, 0x0001, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF, 0x0003, 0x0000, 0x0048, 0x07FF,
+  0x0007, 0x0000, 0x0042, 0x07FF, 0x0005, 0x0000,
+};
+// "Track" disabled: 76x36, 183 runs
+const uint16_t trackButtonDisabledRLE[366] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7BEF, 0x0007, 0x0000, 0x0048, 0x7BEF, 0x0003, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0001, 0x0000, 0x0184, 0x7BEF,
+  0x000A, 0xFFFF, 0x0026, 0x7BEF, 0x0002, 0xFFFF, 0x001A, 0x7BEF, 0x000A, 0xFFFF, 0x0026, 0x7BEF,
+  0x0002, 0xFFFF, 0x001A, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF,
+  0x0002, 0xFFFF, 0x0026, 0x7BEF, 0x0002, 0xFFFF, 0x001A, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0026, 0x7BEF, 0x0002, 0xFFFF, 0x001E, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0004, 0xFFFF, 0x0006, 0x7BEF,
+  0x0004, 0xFFFF, 0x0008, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0018, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF,
+  0x0004, 0xFFFF, 0x0006, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0018, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0004, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0008, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF,
+  0x0002, 0xFFFF, 0x001A, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0004, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0008, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x001A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0004, 0xFFFF, 0x001C, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0004, 0xFFFF, 0x001C, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x001A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x001A, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0018, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0220, 0x7BEF, 0x0001, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0003, 0x0000, 0x0048, 0x7BEF,
+  0x0007, 0x0000, 0x0042, 0x7BEF, 0x0005, 0x0000,
+};
+// "Track" touched: 76x36, 183 runs
+const uint16_t trackButtonTouchedRLE[366] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x000F, 0x0007, 0x0000, 0x0048, 0x000F, 0x0003, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F, 0x0001, 0x0000, 0x0184, 0x000F,
+  0x000A, 0x07FF, 0x0026, 0x000F, 0x0002, 0x07FF, 0x001A, 0x000F, 0x000A, 0x07FF, 0x0026, 0x000F,
+  0x0002, 0x07FF, 0x001A, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F,
+  0x0002, 0x07FF, 0x0026, 0x000F, 0x0002, 0x07FF, 0x001A, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0026, 0x000F, 0x0002, 0x07FF, 0x001E, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F,
+  0x0004, 0x07FF, 0x0008, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0018, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F,
+  0x0004, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0018, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0004, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0008, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F,
+  0x0002, 0x07FF, 0x001A, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0004, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0008, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x001A, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000C, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x000A, 0x000F, 0x0004, 0x07FF, 0x001C, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x000C, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0004, 0x07FF, 0x001C, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x001A, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F,
+  0x0002, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x001A, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x000C, 0x000F, 0x0008, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0018, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x000C, 0x000F, 0x0008, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF, 0x0004, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0220, 0x000F, 0x0001, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F, 0x0003, 0x0000, 0x0048, 0x000F,
+  0x0007, 0x0000, 0x0042, 0x000F, 0x0005, 0x0000,
+};
+// "Full" enabled: 76x36, 147 runs
+const uint16_t fullButtonEnabledRLE[294] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x07FF, 0x0007, 0x0000, 0x0048, 0x07FF, 0x0003, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF, 0x0001, 0x0000, 0x018A, 0x07FF,
+  0x000A, 0x000F, 0x0010, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF, 0x0004, 0x000F, 0x0022, 0x07FF,
+  0x000A, 0x000F, 0x0010, 0x07FF, 0x0004, 0x000F, 0x0008, 0x07FF, 0x0004, 0x000F, 0x0022, 0x07FF,
+  0x0002, 0x000F, 0x001A, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF,
+  0x0002, 0x000F, 0x001A, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF,
+  0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0022, 0x07FF, 0x0008, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF,
+  0x0008, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0022, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF,
+  0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF,
+  0x0002, 0x000F, 0x000A, 0x07FF, 0x0002, 0x000F, 0x0022, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF, 0x0002, 0x000F, 0x000A, 0x07FF,
+  0x0002, 0x000F, 0x0022, 0x07FF, 0x0002, 0x000F, 0x000C, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF,
+  0x0002, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F, 0x0020, 0x07FF,
+  0x0002, 0x000F, 0x000C, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0002, 0x000F, 0x0004, 0x07FF,
+  0x0006, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F, 0x0226, 0x07FF, 0x0001, 0x0000, 0x004A, 0x07FF,
+  0x0002, 0x0000, 0x004A, 0x07FF, 0x0002, 0x0000, 0x004A, 0x07FF, 0x0003, 0x0000, 0x0048, 0x07FF,
+  0x0007, 0x0000, 0x0042, 0x07FF, 0x0005, 0x0000,
+};
+// "Full" disabled: 76x36, 147 runs
+const uint16_t fullButtonDisabledRLE[294] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7BEF, 0x0007, 0x0000, 0x0048, 0x7BEF, 0x0003, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0001, 0x0000, 0x018A, 0x7BEF,
+  0x000A, 0xFFFF, 0x0010, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF, 0x0004, 0xFFFF, 0x0022, 0x7BEF,
+  0x000A, 0xFFFF, 0x0010, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF, 0x0004, 0xFFFF, 0x0022, 0x7BEF,
+  0x0002, 0xFFFF, 0x001A, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF,
+  0x0002, 0xFFFF, 0x001A, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0022, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF,
+  0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0022, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0004, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0022, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0004, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0022, 0x7BEF, 0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0004, 0xFFFF, 0x0002, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF, 0x0006, 0xFFFF, 0x0020, 0x7BEF,
+  0x0002, 0xFFFF, 0x000C, 0x7BEF, 0x0004, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0006, 0xFFFF, 0x0006, 0x7BEF, 0x0006, 0xFFFF, 0x0226, 0x7BEF, 0x0001, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0003, 0x0000, 0x0048, 0x7BEF,
+  0x0007, 0x0000, 0x0042, 0x7BEF, 0x0005, 0x0000,
+};
+// "Full" touched: 76x36, 147 runs
+const uint16_t fullButtonTouchedRLE[294] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x000F, 0x0007, 0x0000, 0x0048, 0x000F, 0x0003, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F, 0x0001, 0x0000, 0x018A, 0x000F,
+  0x000A, 0x07FF, 0x0010, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F, 0x0004, 0x07FF, 0x0022, 0x000F,
+  0x000A, 0x07FF, 0x0010, 0x000F, 0x0004, 0x07FF, 0x0008, 0x000F, 0x0004, 0x07FF, 0x0022, 0x000F,
+  0x0002, 0x07FF, 0x001A, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F,
+  0x0002, 0x07FF, 0x001A, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F,
+  0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0022, 0x000F, 0x0008, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F,
+  0x0008, 0x07FF, 0x0004, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0022, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F,
+  0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F,
+  0x0002, 0x07FF, 0x000A, 0x000F, 0x0002, 0x07FF, 0x0022, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0004, 0x07FF, 0x0006, 0x000F, 0x0002, 0x07FF, 0x000A, 0x000F,
+  0x0002, 0x07FF, 0x0022, 0x000F, 0x0002, 0x07FF, 0x000C, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F,
+  0x0002, 0x07FF, 0x0004, 0x000F, 0x0006, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF, 0x0020, 0x000F,
+  0x0002, 0x07FF, 0x000C, 0x000F, 0x0004, 0x07FF, 0x0002, 0x000F, 0x0002, 0x07FF, 0x0004, 0x000F,
+  0x0006, 0x07FF, 0x0006, 0x000F, 0x0006, 0x07FF, 0x0226, 0x000F, 0x0001, 0x0000, 0x004A, 0x000F,
+  0x0002, 0x0000, 0x004A, 0x000F, 0x0002, 0x0000, 0x004A, 0x000F, 0x0003, 0x0000, 0x0048, 0x000F,
+  0x0007, 0x0000, 0x0042, 0x000F, 0x0005, 0x0000,
+};
+// "Reset" enabled: 76x36, 171 runs
+const uint16_t resetButtonEnabledRLE[342] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7800, 0x0007, 0x0000, 0x0048, 0x7800, 0x0003, 0x0000, 0x004A, 0x7800,
+  0x0002, 0x0000, 0x004A, 0x7800, 0x0002, 0x0000, 0x004A, 0x7800, 0x0001, 0x0000, 0x0184, 0x7800,
+  0x0008, 0xFFE0, 0x002C, 0x7800, 0x0002, 0xFFE0, 0x0016, 0x7800, 0x0008, 0xFFE0, 0x002C, 0x7800,
+  0x0002, 0xFFE0, 0x0016, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x002A, 0x7800,
+  0x0002, 0xFFE0, 0x0016, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x002A, 0x7800,
+  0x0002, 0xFFE0, 0x0016, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0006, 0xFFE0, 0x0006, 0x7800, 0x0008, 0xFFE0, 0x0004, 0x7800, 0x0006, 0xFFE0, 0x0004, 0x7800,
+  0x000A, 0xFFE0, 0x0012, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0006, 0xFFE0, 0x0006, 0x7800, 0x0008, 0xFFE0, 0x0004, 0x7800, 0x0006, 0xFFE0, 0x0004, 0x7800,
+  0x000A, 0xFFE0, 0x0012, 0x7800, 0x0008, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x0002, 0x7800, 0x0002, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0016, 0x7800, 0x0008, 0xFFE0, 0x0004, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0002, 0x7800, 0x0002, 0xFFE0, 0x000A, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0016, 0x7800,
+  0x0002, 0xFFE0, 0x0002, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x000A, 0xFFE0, 0x0004, 0x7800,
+  0x0006, 0xFFE0, 0x0004, 0x7800, 0x000A, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0016, 0x7800,
+  0x0002, 0xFFE0, 0x0002, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x000A, 0xFFE0, 0x0004, 0x7800,
+  0x0006, 0xFFE0, 0x0004, 0x7800, 0x000A, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0016, 0x7800,
+  0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0012, 0x7800,
+  0x0002, 0xFFE0, 0x0002, 0x7800, 0x0002, 0xFFE0, 0x000E, 0x7800, 0x0002, 0xFFE0, 0x0002, 0x7800,
+  0x0002, 0xFFE0, 0x0012, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0002, 0xFFE0, 0x0012, 0x7800, 0x0002, 0xFFE0, 0x0002, 0x7800, 0x0002, 0xFFE0, 0x000E, 0x7800,
+  0x0002, 0xFFE0, 0x0002, 0x7800, 0x0002, 0xFFE0, 0x0012, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x0004, 0x7800, 0x0006, 0xFFE0, 0x0004, 0x7800, 0x0008, 0xFFE0, 0x0006, 0x7800,
+  0x0006, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0014, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x0004, 0x7800, 0x0006, 0xFFE0, 0x0004, 0x7800, 0x0008, 0xFFE0, 0x0006, 0x7800,
+  0x0006, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0220, 0x7800, 0x0001, 0x0000, 0x004A, 0x7800,
+  0x0002, 0x0000, 0x004A, 0x7800, 0x0002, 0x0000, 0x004A, 0x7800, 0x0003, 0x0000, 0x0048, 0x7800,
+  0x0007, 0x0000, 0x0042, 0x7800, 0x0005, 0x0000,
+};
+// "Reset" disabled: 76x36, 171 runs
+const uint16_t resetButtonDisabledRLE[342] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7BEF, 0x0007, 0x0000, 0x0048, 0x7BEF, 0x0003, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0001, 0x0000, 0x0184, 0x7BEF,
+  0x0008, 0xFFFF, 0x002C, 0x7BEF, 0x0002, 0xFFFF, 0x0016, 0x7BEF, 0x0008, 0xFFFF, 0x002C, 0x7BEF,
+  0x0002, 0xFFFF, 0x0016, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x002A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0016, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x002A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0016, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0006, 0xFFFF, 0x0006, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF,
+  0x000A, 0xFFFF, 0x0012, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0006, 0xFFFF, 0x0006, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF,
+  0x000A, 0xFFFF, 0x0012, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0016, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0016, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x000A, 0xFFFF, 0x0004, 0x7BEF,
+  0x0006, 0xFFFF, 0x0004, 0x7BEF, 0x000A, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0016, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x000A, 0xFFFF, 0x0004, 0x7BEF,
+  0x0006, 0xFFFF, 0x0004, 0x7BEF, 0x000A, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0016, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0012, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x000E, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF,
+  0x0002, 0xFFFF, 0x0012, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0012, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x000E, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0002, 0xFFFF, 0x0012, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF, 0x0008, 0xFFFF, 0x0006, 0x7BEF,
+  0x0006, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0014, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0006, 0xFFFF, 0x0004, 0x7BEF, 0x0008, 0xFFFF, 0x0006, 0x7BEF,
+  0x0006, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0220, 0x7BEF, 0x0001, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0003, 0x0000, 0x0048, 0x7BEF,
+  0x0007, 0x0000, 0x0042, 0x7BEF, 0x0005, 0x0000,
+};
+// "Reset" touched: 76x36, 171 runs
+const uint16_t resetButtonTouchedRLE[342] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0xFFE0, 0x0007, 0x0000, 0x0048, 0xFFE0, 0x0003, 0x0000, 0x004A, 0xFFE0,
+  0x0002, 0x0000, 0x004A, 0xFFE0, 0x0002, 0x0000, 0x004A, 0xFFE0, 0x0001, 0x0000, 0x0184, 0xFFE0,
+  0x0008, 0xF800, 0x002C, 0xFFE0, 0x0002, 0xF800, 0x0016, 0xFFE0, 0x0008, 0xF800, 0x002C, 0xFFE0,
+  0x0002, 0xF800, 0x0016, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x002A, 0xFFE0,
+  0x0002, 0xF800, 0x0016, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x002A, 0xFFE0,
+  0x0002, 0xF800, 0x0016, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0006, 0xF800, 0x0006, 0xFFE0, 0x0008, 0xF800, 0x0004, 0xFFE0, 0x0006, 0xF800, 0x0004, 0xFFE0,
+  0x000A, 0xF800, 0x0012, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0006, 0xF800, 0x0006, 0xFFE0, 0x0008, 0xF800, 0x0004, 0xFFE0, 0x0006, 0xF800, 0x0004, 0xFFE0,
+  0x000A, 0xF800, 0x0012, 0xFFE0, 0x0008, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x0002, 0xFFE0, 0x0002, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0016, 0xFFE0, 0x0008, 0xF800, 0x0004, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0002, 0xFFE0, 0x0002, 0xF800, 0x000A, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0016, 0xFFE0,
+  0x0002, 0xF800, 0x0002, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x000A, 0xF800, 0x0004, 0xFFE0,
+  0x0006, 0xF800, 0x0004, 0xFFE0, 0x000A, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0016, 0xFFE0,
+  0x0002, 0xF800, 0x0002, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x000A, 0xF800, 0x0004, 0xFFE0,
+  0x0006, 0xF800, 0x0004, 0xFFE0, 0x000A, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0016, 0xFFE0,
+  0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0012, 0xFFE0,
+  0x0002, 0xF800, 0x0002, 0xFFE0, 0x0002, 0xF800, 0x000E, 0xFFE0, 0x0002, 0xF800, 0x0002, 0xFFE0,
+  0x0002, 0xF800, 0x0012, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0002, 0xF800, 0x0012, 0xFFE0, 0x0002, 0xF800, 0x0002, 0xFFE0, 0x0002, 0xF800, 0x000E, 0xFFE0,
+  0x0002, 0xF800, 0x0002, 0xFFE0, 0x0002, 0xF800, 0x0012, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x0004, 0xFFE0, 0x0006, 0xF800, 0x0004, 0xFFE0, 0x0008, 0xF800, 0x0006, 0xFFE0,
+  0x0006, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0014, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x0004, 0xFFE0, 0x0006, 0xF800, 0x0004, 0xFFE0, 0x0008, 0xF800, 0x0006, 0xFFE0,
+  0x0006, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0220, 0xFFE0, 0x0001, 0x0000, 0x004A, 0xFFE0,
+  0x0002, 0x0000, 0x004A, 0xFFE0, 0x0002, 0x0000, 0x004A, 0xFFE0, 0x0003, 0x0000, 0x0048, 0xFFE0,
+  0x0007, 0x0000, 0x0042, 0xFFE0, 0x0005, 0x0000,
+};
+// "Off" enabled: 76x36, 135 runs
+const uint16_t offButtonEnabledRLE[270] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7800, 0x0007, 0x0000, 0x0048, 0x7800, 0x0003, 0x0000, 0x004A, 0x7800,
+  0x0002, 0x0000, 0x004A, 0x7800, 0x0002, 0x0000, 0x004A, 0x7800, 0x0001, 0x0000, 0x0192, 0x7800,
+  0x0006, 0xFFE0, 0x0008, 0x7800, 0x0004, 0xFFE0, 0x0008, 0x7800, 0x0004, 0xFFE0, 0x002E, 0x7800,
+  0x0006, 0xFFE0, 0x0008, 0x7800, 0x0004, 0xFFE0, 0x0008, 0x7800, 0x0004, 0xFFE0, 0x002C, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x002A, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x002A, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x000A, 0x7800,
+  0x0002, 0xFFE0, 0x0030, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0002, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0030, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x0002, 0x7800, 0x0008, 0xFFE0, 0x0004, 0x7800, 0x0008, 0xFFE0, 0x002C, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0002, 0x7800, 0x0008, 0xFFE0, 0x0004, 0x7800,
+  0x0008, 0xFFE0, 0x002C, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0002, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0030, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0030, 0x7800,
+  0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800, 0x0002, 0xFFE0, 0x000A, 0x7800,
+  0x0002, 0xFFE0, 0x0030, 0x7800, 0x0002, 0xFFE0, 0x0006, 0x7800, 0x0002, 0xFFE0, 0x0004, 0x7800,
+  0x0002, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0032, 0x7800, 0x0006, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0032, 0x7800, 0x0006, 0xFFE0, 0x0006, 0x7800,
+  0x0002, 0xFFE0, 0x000A, 0x7800, 0x0002, 0xFFE0, 0x0230, 0x7800, 0x0001, 0x0000, 0x004A, 0x7800,
+  0x0002, 0x0000, 0x004A, 0x7800, 0x0002, 0x0000, 0x004A, 0x7800, 0x0003, 0x0000, 0x0048, 0x7800,
+  0x0007, 0x0000, 0x0042, 0x7800, 0x0005, 0x0000,
+};
+// "Off" disabled: 76x36, 135 runs
+const uint16_t offButtonDisabledRLE[270] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0x7BEF, 0x0007, 0x0000, 0x0048, 0x7BEF, 0x0003, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0001, 0x0000, 0x0192, 0x7BEF,
+  0x0006, 0xFFFF, 0x0008, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF, 0x0004, 0xFFFF, 0x002E, 0x7BEF,
+  0x0006, 0xFFFF, 0x0008, 0x7BEF, 0x0004, 0xFFFF, 0x0008, 0x7BEF, 0x0004, 0xFFFF, 0x002C, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x002A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x002A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0030, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0030, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF, 0x0008, 0xFFFF, 0x002C, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0002, 0x7BEF, 0x0008, 0xFFFF, 0x0004, 0x7BEF,
+  0x0008, 0xFFFF, 0x002C, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0030, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0030, 0x7BEF,
+  0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF, 0x0002, 0xFFFF, 0x000A, 0x7BEF,
+  0x0002, 0xFFFF, 0x0030, 0x7BEF, 0x0002, 0xFFFF, 0x0006, 0x7BEF, 0x0002, 0xFFFF, 0x0004, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0032, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0032, 0x7BEF, 0x0006, 0xFFFF, 0x0006, 0x7BEF,
+  0x0002, 0xFFFF, 0x000A, 0x7BEF, 0x0002, 0xFFFF, 0x0230, 0x7BEF, 0x0001, 0x0000, 0x004A, 0x7BEF,
+  0x0002, 0x0000, 0x004A, 0x7BEF, 0x0002, 0x0000, 0x004A, 0x7BEF, 0x0003, 0x0000, 0x0048, 0x7BEF,
+  0x0007, 0x0000, 0x0042, 0x7BEF, 0x0005, 0x0000,
+};
+// "Off" touched: 76x36, 135 runs
+const uint16_t offButtonTouchedRLE[270] PROGMEM = {
+  0x0005, 0x0000, 0x0042, 0xFFE0, 0x0007, 0x0000, 0x0048, 0xFFE0, 0x0003, 0x0000, 0x004A, 0xFFE0,
+  0x0002, 0x0000, 0x004A, 0xFFE0, 0x0002, 0x0000, 0x004A, 0xFFE0, 0x0001, 0x0000, 0x0192, 0xFFE0,
+  0x0006, 0xF800, 0x0008, 0xFFE0, 0x0004, 0xF800, 0x0008, 0xFFE0, 0x0004, 0xF800, 0x002E, 0xFFE0,
+  0x0006, 0xF800, 0x0008, 0xFFE0, 0x0004, 0xF800, 0x0008, 0xFFE0, 0x0004, 0xF800, 0x002C, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x002A, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x002A, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x000A, 0xFFE0,
+  0x0002, 0xF800, 0x0030, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0002, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0030, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x0002, 0xFFE0, 0x0008, 0xF800, 0x0004, 0xFFE0, 0x0008, 0xF800, 0x002C, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0002, 0xFFE0, 0x0008, 0xF800, 0x0004, 0xFFE0,
+  0x0008, 0xF800, 0x002C, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0002, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0030, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0030, 0xFFE0,
+  0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0, 0x0002, 0xF800, 0x000A, 0xFFE0,
+  0x0002, 0xF800, 0x0030, 0xFFE0, 0x0002, 0xF800, 0x0006, 0xFFE0, 0x0002, 0xF800, 0x0004, 0xFFE0,
+  0x0002, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0032, 0xFFE0, 0x0006, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0032, 0xFFE0, 0x0006, 0xF800, 0x0006, 0xFFE0,
+  0x0002, 0xF800, 0x000A, 0xFFE0, 0x0002, 0xF800, 0x0230, 0xFFE0, 0x0001, 0x0000, 0x004A, 0xFFE0,
+  0x0002, 0x0000, 0x004A, 0xFFE0, 0x0002, 0x0000, 0x004A, 0xFFE0, 0x0003, 0x0000, 0x0048, 0xFFE0,
+  0x0007, 0x0000, 0x0042, 0xFFE0, 0x0005, 0x0000,
+};
+
+#define NUM_BUTTON_BITMAP        6
+#define NUM_BUTTON_BITMAP_STATE  3
+#define BUTTON_BITMAP_PIXELS_MAX 2736
+
+typedef struct {
+  int16_t         width;
+  int16_t         height;
+  size_t          length; // number of words in rle, two per run
+  uint16_t const *rle;    // (count, color) pairs, row-major
+} Button_Bitmap;
+
+// indexed by User_Command, then Button_State
+const Button_Bitmap buttonBitmap[NUM_BUTTON_BITMAP][NUM_BUTTON_BITMAP_STATE] = {
+  {
+    { 76, 36, sizeof(passiveButtonEnabledRLE) / sizeof(*passiveButtonEnabledRLE), passiveButtonEnabledRLE },
+    { 76, 36, sizeof(passiveButtonDisabledRLE) / sizeof(*passiveButtonDisabledRLE), passiveButtonDisabledRLE },
+    { 76, 36, sizeof(passiveButtonTouchedRLE) / sizeof(*passiveButtonTouchedRLE), passiveButtonTouchedRLE },
+  },
+  {
+    { 76, 36, sizeof(safeButtonEnabledRLE) / sizeof(*safeButtonEnabledRLE), safeButtonEnabledRLE },
+    { 76, 36, sizeof(safeButtonDisabledRLE) / sizeof(*safeButtonDisabledRLE), safeButtonDisabledRLE },
+    { 76, 36, sizeof(safeButtonTouchedRLE) / sizeof(*safeButtonTouchedRLE), safeButtonTouchedRLE },
+  },
+  {
+    { 76, 36, sizeof(trackButtonEnabledRLE) / sizeof(*trackButtonEnabledRLE), trackButtonEnabledRLE },
+    { 76, 36, sizeof(trackButtonDisabledRLE) / sizeof(*trackButtonDisabledRLE), trackButtonDisabledRLE },
+    { 76, 36, sizeof(trackButtonTouchedRLE) / sizeof(*trackButtonTouchedRLE), trackButtonTouchedRLE },
+  },
+  {
+    { 76, 36, sizeof(fullButtonEnabledRLE) / sizeof(*fullButtonEnabledRLE), fullButtonEnabledRLE },
+    { 76, 36, sizeof(fullButtonDisabledRLE) / sizeof(*fullButtonDisabledRLE), fullButtonDisabledRLE },
+    { 76, 36, sizeof(fullButtonTouchedRLE) / sizeof(*fullButtonTouchedRLE), fullButtonTouchedRLE },
+  },
+  {
+    { 76, 36, sizeof(resetButtonEnabledRLE) / sizeof(*resetButtonEnabledRLE), resetButtonEnabledRLE },
+    { 76, 36, sizeof(resetButtonDisabledRLE) / sizeof(*resetButtonDisabledRLE), resetButtonDisabledRLE },
+    { 76, 36, sizeof(resetButtonTouchedRLE) / sizeof(*resetButtonTouchedRLE), resetButtonTouchedRLE },
+  },
+  {
+    { 76, 36, sizeof(offButtonEnabledRLE) / sizeof(*offButtonEnabledRLE), offButtonEnabledRLE },
+    { 76, 36, sizeof(offButtonDisabledRLE) / sizeof(*offButtonDisabledRLE), offButtonDisabledRLE },
+    { 76, 36, sizeof(offButtonTouchedRLE) / sizeof(*offButtonTouchedRLE), offButtonTouchedRLE },
+  },
+};
+
+#endif // !defined(__BUTTON_BITMAPS_H__)
@@ -9,59 +9,99 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <climits>
+#include <iterator>
 #include <list>
 
+#include <ADC.h> // from Teensyduino
 #include <ILI9341_t3.h>
 #include <XPT2046_Touchscreen.h>
 
-// pins used on the Teensy 3.6
-#define NUM_IR_DIODE    6
-#define IR_DIODE_1_PIN  A0
-#define IR_DIODE_2_PIN  A1
-#define IR_DIODE_3_PIN  A2
-#define IR_DIODE_4_PIN  A3
-#define IR_DIODE_5_PIN  A4
-#define IR_DIODE_6_PIN  A5
-#define IR_DIODE_LED(pin) ((pin) - IR_DIODE_1_PIN)
-
-#define ANALOG_READ_MIN    0
-#define ANALOG_READ_MAX 1023
-
-// general configuration
-int16_t const POLL_FREQ_MS = 10; // frequency in which we poll all sensors (milliseconds)
-#define HAS_POLL_ELAPSED(since) (millis() - (since) >= POLL_FREQ_MS)
-
-// configuration for the IR signal low-pass filter (rolling mean)
-int16_t const IR_POLL_FREQ_MS     =   10;
+// cathys-sensor project includes
+#include "noise-floor.h"
+#include "oversample.h"
+#include "sample-rate.h"
+#include "sensor-time.h"
+#include "static-arena.h"
+
+// uncomment only on robots fitted with the optional rear-facing diode array.
+// otherwise its pins are left floating, and must not be sampled.
+//#define CATHYS_REAR_IR_ARRAY
+
+// the diodes are grouped into arrays, each an arc of IR_DIODES_PER_ARRAY
+// diodes spanning [ANGLE_MIN_DEG, ANGLE_MAX_DEG] about the heading it faces.
+// diode index i of array a is diode a*IR_DIODES_PER_ARRAY+i overall.
+#define NUM_IR_ARRAY_MAX     2
+#if defined(CATHYS_REAR_IR_ARRAY)
+#define NUM_IR_ARRAY         2 // front and rear (360°)
+#else
+#define NUM_IR_ARRAY         1 // front only (180°)
+#endif
+#define IR_DIODES_PER_ARRAY  6
+#define NUM_IR_DIODE         (NUM_IR_ARRAY * IR_DIODES_PER_ARRAY)
+#define ANGLE_MIN_DEG      -90
+#define ANGLE_MAX_DEG       90
+
+static_assert(NUM_IR_ARRAY >= 1 && NUM_IR_ARRAY <= NUM_IR_ARRAY_MAX,
+  "unsupported number of IR diode arrays");
+
+// pins used on the Teensy 3.6. arrays are sampled in pairs, with the even
+// array on ADC0 and the odd array on ADC1 converting simultaneously, so the
+// pins of each array must be usable by its ADC module.
+uint8_t const IR_DIODE_PIN[NUM_IR_ARRAY_MAX][IR_DIODES_PER_ARRAY] = {
+  { A0,  A1,  A2,  A3,  A4,  A5  }, // front (ADC0)
+  { A15, A16, A17, A18, A19, A20 }, // rear  (ADC1)
+};
+// direction each array faces, counter-clockwise from the front of the robot
+int16_t const IR_ARRAY_HEADING_DEG[NUM_IR_ARRAY_MAX] = { 0, 180 };
+
+// each diode's bearing is also kept as a unit vector in Q14 fixed-point, so
+// that the rolling mean of bearings can be kept in exact integer sums.
+#define IR_BEARING_ONE 16384
+
+// configuration for the IR signal low-pass filter (time-weighted rolling mean).
+// the poll period itself is chosen by the Sample_Rate_Controller, and signal
+// validity is decided against each diode's Noise_Floor by the Signal_Detector.
 int16_t const IR_SAMPLE_WINDOW_MS = 2500; // (2.5-second sampling)
-#define HAS_SAMPLE_WINDOW_EXPIRED(since) (millis() - (since) >= IR_SAMPLE_WINDOW_MS)
-float   const IR_SIGNAL_MINIMUM   = 100.0 / NUM_IR_DIODE; // signal validity threshold in [0%, 100%]
+#define HAS_SAMPLE_WINDOW_EXPIRED(since) hasTimeElapsed((since), MS_TO_US(IR_SAMPLE_WINDOW_MS))
+// number of samples that can be held in the rolling window. polls are at least
+// IR_POLL_MIN_US apart, plus the oldest sample (which straddles the start of
+// the window) and the newest one, appended before the oldest is evicted.
+size_t  const IR_SAMPLE_POOL_SIZE = MS_TO_US(IR_SAMPLE_WINDOW_MS) / IR_POLL_MIN_US + 2;
 
 float   const IR_AVERAGE_INVALID     = -1.0;
 #define IR_AVERAGE_VALID(v) (fabs((v) - IR_AVERAGE_INVALID) >= 0.001)
 
 uint8_t const IR_DIODE_PIN_INVALID   = UCHAR_MAX;
-int16_t const IR_DIODE_VALUE_INVALID = SHRT_MAX; // greater than analogRead() maximum (1023)
-int16_t const IR_DIODE_VALUE_MAXIMUM = ANALOG_READ_MAX;
-int16_t const IR_DIODE_VALUE_MINIMUM = ANALOG_READ_MIN;
-int16_t const IR_DIODE_TIME_VALID    = -1; // pre-history? ..or the future?!
+int16_t const IR_DIODE_VALUE_INVALID = SHRT_MAX; // greater than any sample (IR_SAMPLE_MAX)
+int16_t const IR_DIODE_VALUE_MAXIMUM = IR_SAMPLE_MAX;
+int16_t const IR_DIODE_VALUE_MINIMUM = IR_SAMPLE_MIN;
 class Infrared_Diode {
 public:
   Infrared_Diode()
     : _pin(IR_DIODE_PIN_INVALID),
+      _led(0),
       _value(IR_DIODE_VALUE_INVALID),
-      _time(IR_DIODE_TIME_VALID)
+      _time(0)
     { /* constructor empty */ }
-  Infrared_Diode(uint8_t pin)
+  Infrared_Diode(uint8_t pin, uint8_t led)
     : _pin(pin),
+      _led(led),
       _value(IR_DIODE_VALUE_INVALID),
-      _time(IR_DIODE_TIME_VALID)
+      _time(0)
     { /* constructor empty */ }
   Infrared_Diode(const Infrared_Diode &diode) // copy-constructor
     : _pin(diode._pin),
+      _led(diode._led),
       _value(diode._value),
       _time(diode._time)
     { /* constructor empty */ }
+  Infrared_Diode &operator =(const Infrared_Diode &diode) { // copy-assignment
+    _pin   = diode._pin;
+    _led   = diode._led;
+    _value = diode._value;
+    _time  = diode._time;
+    return *this;
+  }
   inline bool operator <(const Infrared_Diode &diode) const {
     return _value < diode._value;
   }
@@ -76,99 +116,187 @@ public:
     if (r < 0) { r = 0; }
     return (float)r * 100.0 / IR_DIODE_VALUE_MAXIMUM;
   }
-  void update() {
+  void update(int16_t value, Timestamp time) { // value as read from _pin
     if (IR_DIODE_PIN_INVALID != _pin) {
-      _value = analogRead(_pin);
-      _time = millis();
+      _value = value;
+      _time  = time;
     }
   }
   inline bool valid() const {
+    // every timestamp value is legitimate (micros() wraps), so only the value
+    // can tell us whether the diode has ever been sampled.
     return
       (_pin != IR_DIODE_PIN_INVALID) &&
-      (_value != IR_DIODE_VALUE_INVALID) &&
-      (_time != IR_DIODE_TIME_VALID);
+      (_value != IR_DIODE_VALUE_INVALID);
   }
-  inline uint8_t led()   const { return IR_DIODE_LED(_pin); }
+  inline uint8_t led()   const { return _led; } // index among all diodes
   inline uint8_t pin()   const { return _pin; }
   inline int16_t value() const { return _value; }
-  inline int16_t time()  const { return _time; }
+  inline Timestamp time() const { return _time; }
   inline float   grade() const { return Infrared_Diode::grade(_value); }
 
 private:
   uint8_t _pin;
+  uint8_t _led;
   int16_t _value;
-  int16_t _time;
+  Timestamp _time;
 };
 
+// the rolling window's nodes are recycled from a static pool, never the heap
+typedef std::list<Infrared_Diode, Pool_Allocator<Infrared_Diode, IR_SAMPLE_POOL_SIZE>> Infrared_Diode_List;
+
 class Cathys_Sensor {
 public:
-  Cathys_Sensor(
-    uint8_t diodePin1 = IR_DIODE_1_PIN,
-    uint8_t diodePin2 = IR_DIODE_2_PIN,
-    uint8_t diodePin3 = IR_DIODE_3_PIN,
-    uint8_t diodePin4 = IR_DIODE_4_PIN,
-    uint8_t diodePin5 = IR_DIODE_5_PIN,
-    uint8_t diodePin6 = IR_DIODE_6_PIN)
-      : _diode({
-          Infrared_Diode(diodePin1),
-          Infrared_Diode(diodePin2),
-          Infrared_Diode(diodePin3),
-          Infrared_Diode(diodePin4),
-          Infrared_Diode(diodePin5),
-          Infrared_Diode(diodePin6)
-        }),
-        _averageLED(IR_AVERAGE_INVALID),
+  Cathys_Sensor()
+      : _averageBearing(IR_AVERAGE_INVALID),
         _averageValue(IR_AVERAGE_INVALID),
         _accumulateIR(true),
-        _diodeList({})
-    { /* constructor empty */ }
+        _diodeList({}),
+        _time(0),
+        _pollTime(0),
+        _rate(),
+        _detector(),
+        _pollStats(0),
+        _adc(),
+        _decimator()
+  {
+    for (size_t a = 0; a < NUM_IR_ARRAY; ++a) {
+      for (size_t j = 0; j < IR_DIODES_PER_ARRAY; ++j) {
+        size_t i = a * IR_DIODES_PER_ARRAY + j;
+        _diode[i] = Infrared_Diode(IR_DIODE_PIN[a][j], i);
+        // the diodes of each array are evenly spaced across its span
+        float bearing = IR_ARRAY_HEADING_DEG[a] + ANGLE_MIN_DEG +
+          (float)(ANGLE_MAX_DEG - ANGLE_MIN_DEG) * j / (IR_DIODES_PER_ARRAY - 1);
+        _bearing[i]  = _wrapDegrees((int16_t)roundf(bearing));
+        _bearingX[i] = (int16_t)roundf(cosf(bearing * DEG_TO_RAD) * IR_BEARING_ONE);
+        _bearingY[i] = (int16_t)roundf(sinf(bearing * DEG_TO_RAD) * IR_BEARING_ONE);
+        _snr[i]      = 0.0;
+      }
+    }
+  }
   void begin() {
     //Serial.begin(9600);
+    _adc.adc0->setResolution(IR_ADC_RESOLUTION);
+    _adc.adc0->setAveraging(IR_ADC_AVERAGING);
+    _adc.adc1->setResolution(IR_ADC_RESOLUTION);
+    _adc.adc1->setAveraging(IR_ADC_AVERAGING);
+    _pollTime = timestampNow();
   }
-  void loop() {
-    static int      lastTime   = millis();
-    static int      startTime  = millis();
-    static uint32_t numSamples = 0; // unchanging post-accumulation
-    static int32_t  sumLED     = 0;
-    static int32_t  sumValue   = 0;
+  bool loop() { // returns true if a new frame was sampled
+    static Timestamp startTime = timestampNow();
+    // sums of each sample weighted by how long it was the latest sample (in
+    // microseconds), so that the mean is correct at any sample rate.
+    static uint32_t sumWeight  = 0;
+    static int64_t  sumX       = 0; // bearing unit vectors (Q14)
+    static int64_t  sumY       = 0;
+    static int64_t  sumValue   = 0;
+
+    if (hasTimeElapsed(_pollTime, _rate.period())) {
+      Timestamp now = timestampNow();
+      // lateness relative to the scheduled poll, since the period varies
+      _pollStats.add(timeElapsed(_pollTime, now) - _rate.period());
+      Timestamp lastTime = _time;
+      // schedule from the start of this poll, not the end, so that the time
+      // spent polling does not accumulate into the period.
+      _pollTime = now;
 
-    if (HAS_POLL_ELAPSED(lastTime)) {
       Infrared_Diode brightest  = Infrared_Diode();
-      // poll each infrared diode effectively as an atomic operation.
-      for (int i = 0; i < NUM_IR_DIODE; ++i) {
-        _diode[i].update();
+      // poll each infrared diode effectively as an atomic operation. the
+      // frame is stamped with the time its last diode was sampled.
+      _time = _sample();
+      for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
         brightest = min(brightest, _diode[i]);
       }
-       // append the latest "best" signal to our list of samples
+      _rate.update(_bearing[brightest.led()], brightest.value());
+
+      // each diode is compared against its own floor before the floor learns
+      // from this frame, and the frame's ratio is that of its clearest diode.
+      uint32_t dt       = timeElapsed(lastTime, _time);
+      float    snr      = 0.0;
+      size_t   brighter = 0;
+      for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
+        _snr[i] = _floor[i].snr(_diode[i].value());
+        if (_snr[i] > snr)           { snr = _snr[i]; }
+        if (_snr[i] > NOISE_OUTLIER) { ++brighter; }
+      }
+      bool ambientShift = brighter > NOISE_AMBIENT_SHIFT * NUM_IR_DIODE;
+      for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
+        _floor[i].update(_diode[i].value(), dt, ambientShift);
+      }
+      _detector.update(snr, dt);
+
+      // the previous sample held until this one arrived, which determines its
+      // weight. append the latest "best" signal to our list of samples.
+      if (!_diodeList.empty()) {
+        const Infrared_Diode &previous = _diodeList.front();
+        uint32_t weight = timeElapsed(previous.time(), brightest.time());
+        sumWeight += weight;
+        sumX      += (int64_t)_bearingX[previous.led()] * weight;
+        sumY      += (int64_t)_bearingY[previous.led()] * weight;
+        sumValue  += (int64_t)previous.value() * weight;
+      }
       _diodeList.push_front(brightest);
 
-      if (_accumulateIR) {
-        // accumulate infrared samples for calculating an average IR direction;
-        // the direction will not yet be available until a sufficient amount of
-        // time has elapsed (per IR_SAMPLE_WINDOW_MS).
-        ++numSamples;
-        sumLED   += brightest.led();
-        sumValue += brightest.value();
-        if (HAS_SAMPLE_WINDOW_EXPIRED(startTime)) {
-          // pool is ready, bail out of the accumulation phase. all subsequent
-          // iterations will be adjustments to this calculated average.
-          _accumulateIR = false;
-          _averageLED   = (float)sumLED   / numSamples;
-          _averageValue = (float)sumValue / numSamples;
+      // evict samples that held entirely before the start of the window. the
+      // oldest sample is kept until its successor is also outside the window,
+      // so the weighted span never falls short of IR_SAMPLE_WINDOW_MS.
+      while (_diodeList.size() > 2) {
+        const Infrared_Diode &oldest    = _diodeList.back();
+        const Infrared_Diode &successor = *std::next(_diodeList.rbegin());
+        if (timeElapsed(successor.time(), brightest.time()) < MS_TO_US(IR_SAMPLE_WINDOW_MS)) {
+          break;
         }
-      }
-      else {
-        // adjust the calculated average by removing the oldest sample and
-        // including the most recent.
-        sumLED   = brightest.led()   - _diodeList.back().led();
-        sumValue = brightest.value() - _diodeList.back().value();
-        _averageLED   += (float)sumLED   / numSamples;
-        _averageValue += (float)sumValue / numSamples;
+        uint32_t weight = timeElapsed(oldest.time(), successor.time());
+        sumWeight -= weight;
+        sumX      -= (int64_t)_bearingX[oldest.led()] * weight;
+        sumY      -= (int64_t)_bearingY[oldest.led()] * weight;
+        sumValue  -= (int64_t)oldest.value() * weight;
         _diodeList.pop_back();
       }
 
-      lastTime = millis();
+      if (_accumulateIR && HAS_SAMPLE_WINDOW_EXPIRED(startTime)) {
+        // the direction is not available until a sufficient amount of time
+        // has elapsed (per IR_SAMPLE_WINDOW_MS) to fill the window. after
+        // that, every poll updates the average.
+        _accumulateIR = false;
+      }
+      if (!_accumulateIR) {
+        // bearings are averaged as unit vectors (the circular mean), since
+        // e.g. the mean of 170° and -170° is 180°, not 0°.
+        if (sumWeight > 0) {
+          _averageBearing = atan2f((float)sumY, (float)sumX) * RAD_TO_DEG;
+          _averageValue   = (float)sumValue / sumWeight;
+        }
+        else {
+          _averageBearing = _bearing[brightest.led()];
+          _averageValue   = brightest.value();
+        }
+      }
+
+      return true;
     }
+    return false;
+  }
+  inline Timestamp time() const { // when the most recent frame was sampled
+    return _time;
+  }
+  inline uint32_t idleTime() const { // microseconds until the next poll is due
+    uint32_t elapsed = timeElapsed(_pollTime);
+    return elapsed >= _rate.period() ? 0 : _rate.period() - elapsed;
+  }
+  inline uint32_t pollPeriod() const { // current poll period (microseconds)
+    return _rate.period();
+  }
+  // each poll's lateness past its scheduled time is recorded (a nominal of 0),
+  // so the jitter figures describe the scheduling error at whatever rate.
+  inline const Interval_Stats &pollStats() const {
+    return _pollStats;
+  }
+  inline void resetPollStats() {
+    _pollStats.reset();
+  }
+  inline int16_t value(size_t i) const {
+    return _diode[i].value();
   }
   inline float intensity(size_t i) const {
     return _diode[i].grade();
@@ -176,36 +304,103 @@ public:
   inline float intensity() const {
     return Infrared_Diode::grade(_averageValue);
   }
-  inline int16_t angle() const { // output byte value between [-90°, 90°]
-#define ANGLE_MIN_DEG -90
-#define ANGLE_MAX_DEG  90
-    int16_t angle = ANGLE_MIN_DEG +
-      (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * _averageLED / (NUM_IR_DIODE - 1);
-    if (angle < ANGLE_MIN_DEG) { angle = ANGLE_MIN_DEG; }
-    if (angle > ANGLE_MAX_DEG) { angle = ANGLE_MAX_DEG; }
+  inline int16_t angle() const { // bearing between (-180°, 180°]
+    int16_t angle = _wrapDegrees((int16_t)roundf(_averageBearing));
+    if (1 == NUM_IR_ARRAY) {
+      // a lone front array only ever reports [-90°, 90°]
+      if (angle < ANGLE_MIN_DEG) { angle = ANGLE_MIN_DEG; }
+      if (angle > ANGLE_MAX_DEG) { angle = ANGLE_MAX_DEG; }
+    }
     return angle;
   }
+  inline size_t facingArray() const { // array whose heading is nearest angle()
+    size_t  facing  = 0;
+    int16_t nearest = SHRT_MAX;
+    for (size_t a = 0; a < NUM_IR_ARRAY; ++a) {
+      int16_t offset = abs(_wrapDegrees(angle() - IR_ARRAY_HEADING_DEG[a]));
+      if (offset < nearest) {
+        nearest = offset;
+        facing  = a;
+      }
+    }
+    return facing;
+  }
   inline bool ready() const {
     return !_accumulateIR;
   }
-  inline bool active(size_t i, float const minIntensity = IR_SIGNAL_MINIMUM) const {
-    return intensity(i) >= minIntensity;
+  inline float snr(size_t i) const { // diode's signal-to-noise ratio
+    return _snr[i];
+  }
+  inline float snr() const { // smoothed ratio of the clearest diode
+    return _detector.snr();
+  }
+  inline bool active(size_t i) const {
+    return _snr[i] >= IR_SNR_ACQUIRE;
   }
   inline bool valid(size_t i) const {
     return _diode[i].valid();
   }
-  inline bool haveSignal(float const minIntensity = IR_SIGNAL_MINIMUM) const {
+  inline bool haveSignal() const {
     return
       ready()                         &&
       IR_AVERAGE_VALID(_averageValue) &&
-      intensity() >= minIntensity     ;
+      _detector.signal()              ;
   }
 
 private:
   Infrared_Diode _diode[NUM_IR_DIODE];
-  float          _averageLED, _averageValue;
+  int16_t        _bearing[NUM_IR_DIODE];  // degrees, (-180°, 180°]
+  int16_t        _bearingX[NUM_IR_DIODE]; // cos(bearing), Q14
+  int16_t        _bearingY[NUM_IR_DIODE]; // sin(bearing), Q14
+  Noise_Floor    _floor[NUM_IR_DIODE];
+  float          _snr[NUM_IR_DIODE];      // of each diode's latest reading
+  float          _averageBearing, _averageValue;
   bool           _accumulateIR;
-  std::list<Infrared_Diode> _diodeList;
+  Infrared_Diode_List _diodeList;
+  Timestamp      _time;
+  Timestamp      _pollTime; // start of the most recent poll
+  Sample_Rate_Controller _rate;
+  Signal_Detector _detector;
+  Interval_Stats _pollStats;
+  ADC            _adc;
+  Boxcar_Decimator<NUM_IR_DIODE, IR_OVERSAMPLE, IR_OVERSAMPLE_BITS> _decimator;
+
+  static inline int16_t _wrapDegrees(int16_t deg) { // into (-180°, 180°]
+    while (deg <= -180) { deg += 360; }
+    while (deg >   180) { deg -= 360; }
+    return deg;
+  }
+
+  // samples every diode once, each sample decimated from IR_OVERSAMPLE reads.
+  // the reads are taken in rounds over all diodes (rather than all of one
+  // diode's reads at once), so that every diode's sample spans the same time.
+  // the same diode of each pair of arrays is read by both ADC modules at once,
+  // so a second array adds no acquisition time. returns the time at which the
+  // last diode was read.
+  Timestamp _sample() {
+    for (size_t r = 0; r < IR_OVERSAMPLE; ++r) {
+      for (size_t j = 0; j < IR_DIODES_PER_ARRAY; ++j) {
+        for (size_t a = 0; a < NUM_IR_ARRAY; a += 2) {
+          size_t even = a * IR_DIODES_PER_ARRAY + j;
+          if (a + 1 < NUM_IR_ARRAY) {
+            size_t odd = (a + 1) * IR_DIODES_PER_ARRAY + j;
+            ADC::Sync_result result =
+              _adc.analogSynchronizedRead(_diode[even].pin(), _diode[odd].pin());
+            _decimator.add(even, result.result_adc0);
+            _decimator.add(odd,  result.result_adc1);
+          }
+          else {
+            _decimator.add(even, _adc.adc0->analogRead(_diode[even].pin()));
+          }
+        }
+      }
+    }
+    Timestamp time = timestampNow();
+    for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
+      _diode[i].update(_decimator.take(i), time);
+    }
+    return time;
+  }
 };
 
 #endif // !defined(__CATHYS_SENSOR_H__)
\ No newline at end of file
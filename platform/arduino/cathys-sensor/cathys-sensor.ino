@@ -11,10 +11,23 @@
 
 // cathys-sensor project includes
 #include "cathys-sensor.h"
+#include "command-queue.h"
+#include "diag-stream.h"
+#include "idle-loop.h"
 #include "sensor-display.h"
+#include "serial-queue.h"
+#include "static-arena.h"
 
 #define SERIAL_OUTPUT_REQUIRED
 
+// zero-dynamic-allocation build profile: every operator new during setup() is
+// served from a bounded static arena instead of the heap. any allocation the
+// arena cannot serve, either because it is full or because setup() has
+// completed, is counted and falls back to the heap (or, if strict, halts the
+// firmware) so that the steady state is provably allocation-free.
+//#define CATHYS_STATIC_ALLOC
+//#define CATHYS_STATIC_ALLOC_STRICT
+
 static const int SERIAL_BAUD_RATE  = 115200; // bps
 static const int SERIAL_TIMEOUT_MS =  10000; // milliseconds
 #if defined(SERIAL_OUTPUT_REQUIRED)
@@ -26,7 +39,8 @@ static const int SERIAL_TIMEOUT_MS =  10000; // milliseconds
 static const int CATHYS_INPUT_SIZE =   1024; // bytes
 static const int INPUT_TOKEN_SIZE  =     32; // bytes
 static const int RELAY_TIMEOUT_MS  =   2000; // milliseconds
-#define HAS_RELAY_TIMED_OUT(since) (millis() - (since) >= RELAY_TIMEOUT_MS)
+static const int TX_RETRY_US       =   1000; // microseconds
+#define HAS_RELAY_TIMED_OUT(since) hasTimeElapsed((since), MS_TO_US(RELAY_TIMEOUT_MS))
 
 typedef enum {
   srrNotComplete,
@@ -35,15 +49,61 @@ typedef enum {
 
 Cathys_Sensor sensor = Cathys_Sensor();
 Sensor_Display display = Sensor_Display(sensor);
+Serial_Queue txQueue = Serial_Queue(Serial);
+Diagnostic_Stream diag = Diagnostic_Stream();
+Command_Queue commands = Command_Queue();
+Idle_Loop idle = Idle_Loop();
+
+static_assert(DIAG_LINE_MAX <= TXQ_MESSAGE_MAX,
+  "diagnostic packet lines must fit in a single TX queue message");
+
+Timestamp relayMessageTime;
+char      cathysRawInput[CATHYS_INPUT_SIZE]; // full message received via serial
+uint16_t  connStatus;
+char      modeStatus[INPUT_TOKEN_SIZE];
+uint16_t  battStatus;
+uint16_t  diagStatus; // frames per diagnostic packet, 0 to disable
+uint16_t  ackStatus;  // sequence number of the last user command accepted
+
+const size_t sensorDocSize = JSON_OBJECT_SIZE(12);
+StaticJsonDocument<sensorDocSize> sensorDoc;
+
+#if defined(CATHYS_STATIC_ALLOC)
+// replaces the core library's malloc-backed operator new/delete
+Static_Arena<STATIC_ARENA_SIZE> arena;
+
+// operator new must never return nullptr, so whatever the arena refuses is
+// either fatal or served from the heap, where it can also be freed again.
+void *arenaAllocate(size_t size) {
+  void *ptr = arena.allocate(size);
+  if (nullptr == ptr) {
+#if defined(CATHYS_STATIC_ALLOC_STRICT)
+    abort(); // steady state violated, or the arena is undersized
+#else
+    if (nullptr == (ptr = malloc(size > 0 ? size : 1))) {
+      abort(); // out of memory
+    }
+#endif
+  }
+  return ptr;
+}
 
-uint16_t relayMessageTime;
-char     cathysRawInput[CATHYS_INPUT_SIZE]; // full message received via serial
-uint16_t connStatus;
-char     modeStatus[INPUT_TOKEN_SIZE];
-uint16_t battStatus;
+void arenaDeallocate(void *ptr) {
+  if (arena.owns(ptr)) {
+    arena.deallocate(ptr);
+  }
+  else {
+    free(ptr);
+  }
+}
 
-const size_t sensorDocSize = JSON_OBJECT_SIZE(3);
-DynamicJsonDocument sensorDoc = DynamicJsonDocument(sensorDocSize);
+void *operator new(size_t size)           { return arenaAllocate(size); }
+void *operator new[](size_t size)         { return arenaAllocate(size); }
+void  operator delete(void *ptr)          noexcept { arenaDeallocate(ptr); }
+void  operator delete[](void *ptr)        noexcept { arenaDeallocate(ptr); }
+void  operator delete(void *ptr, size_t)   noexcept { arenaDeallocate(ptr); }
+void  operator delete[](void *ptr, size_t) noexcept { arenaDeallocate(ptr); }
+#endif
 
 void setup() {
 
@@ -56,48 +116,117 @@ void setup() {
   connStatus       = 0;
   *modeStatus      = '\0';
   battStatus       = 0;
+  diagStatus       = 0;
+  ackStatus        = CMDQ_SEQUENCE_NONE;
 
   sensor.begin();
   display.begin();
+
+#if defined(CATHYS_STATIC_ALLOC)
+  // all allocation must be complete by now
+  arena.seal();
+#endif
+
+  idle.begin();
 }
 
 void loop() {
 
   static User_Command userCommand;
+  static uint8_t userCommandSeq;
   static Serial_Read_Result readResult;
+  static bool sampled;
+  static bool queued;
+  static bool report;
 
-  sensor.loop();
+  if ((sampled = sensor.loop())) {
+    // stream every raw frame while cathys-drive has diagnostics enabled
+    if (diag.add(sensor, sensor.time())) {
+      queueDiagnostic();
+    }
+  }
   display.loop();
 
-  userCommand = display.userCommand();
+  // each button press is queued once, and delivered by the command queue
+  if (ucmdNONE != (userCommand = display.userCommand())) {
+    commands.push(userCommand);
+  }
+
+  // rebuilt from scratch since the fields present vary. a removed member's
+  // memory would not be reclaimed by the document.
+  sensorDoc.clear();
+
+  // every message carries the time of the frame it describes
+  sensorDoc["time-us"] = sensor.time();
 
   if (sensor.ready() && sensor.haveSignal()) {
 
-    sensorDoc["user-command"] = (int16_t)userCommand;
     sensorDoc["ir-angle"]     = sensor.angle();
     sensorDoc["ir-intensity"] = sensor.intensity();
-
-    serializeJson(sensorDoc, Serial);
-    Serial.println(); // the serializer does not include a newline, which the
-                      // cathys-drive Go parser requires as message delimiter
   }
   else {
 
-    sensorDoc["user-command"] = (int16_t)userCommand;
     sensorDoc["ir-angle"]     = -1;
     sensorDoc["ir-intensity"] = -1.0;
+  }
 
-    serializeJson(sensorDoc, Serial);
-    Serial.println(); // the serializer does not include a newline, which the
-                      // cathys-drive Go parser requires as message delimiter
+  // the duty cycle, the poll scheduling jitter over the same window, and the
+  // running totals of deferred commands and dropped output (and of the arena's
+  // allocation audit, if enabled) are included in every message from when the
+  // duty cycle is measured until one of them has actually been queued.
+  if ((report = idle.dutyCycleUpdated())) {
+    sensorDoc["duty-cycle"]     = idle.dutyCycle();
+    sensorDoc["poll-jitter-us"] = sensor.pollStats().jitter();
+    sensorDoc["poll-late-us"]   = sensor.pollStats().jitterPeak();
+    sensorDoc["cmd-deferred"]   = txQueue.commandsDeferred();
+    sensorDoc["bytes-dropped"]  = txQueue.bytesDropped();
+#if defined(CATHYS_STATIC_ALLOC)
+    // running totals, any nonzero value means the arena is undersized or the
+    // steady state allocates
+    sensorDoc["arena-failures"] = arena.failures();
+    sensorDoc["arena-late"]     = arena.lateAllocations();
+#endif
+  }
+
+  // a user command is only included when it is due to be (re)sent, and such
+  // messages must reach cathys-drive. everything else is telemetry that the
+  // next message will supersede anyway.
+  queued = false;
+  if (ucmdNONE != (userCommand = commands.due(userCommandSeq))) {
+    sensorDoc["user-command"] = (int16_t)userCommand;
+    sensorDoc["cmd-seq"]      = userCommandSeq;
+    if ((queued = queueSensorDoc(tqcCommand))) {
+      commands.didSend();
+    }
+    // otherwise the command ring is full (and the refusal counted), and the
+    // command stays due, so it is offered again on the very next loop.
+  }
+  else if (sampled) {
+    // only a new frame is worth sending, since the loop now also runs on
+    // every wake-up from idle.
+    queued = queueSensorDoc(tqcTelemetry);
+  }
+  if (queued && report) {
+    idle.dutyCycleReported();
+    sensor.resetPollStats();
   }
 
+  // hand off whatever the USB serial port will accept right now. this never
+  // blocks, so a slow (or absent) host cannot stall sampling or touch input.
+  txQueue.pump();
+
   switch ((readResult = readSerial(cathysRawInput))) {
     case srrComplete:
-      sscanf(cathysRawInput, "%hu %s %hu",
-        &connStatus, modeStatus, &battStatus);
+      // the diagnostic and acknowledgement fields are optional, older
+      // cathys-drive do not send them.
+      diagStatus = 0;
+      ackStatus  = CMDQ_SEQUENCE_NONE;
+      sscanf(cathysRawInput, "%hu %s %hu %hu %hu",
+        &connStatus, modeStatus, &battStatus, &diagStatus, &ackStatus);
+      diag.setBatchSize(diagStatus);
+      commands.acknowledge(ackStatus);
       if (!!connStatus) {
-        relayMessageTime = millis();
+        relayMessageTime = timestampNow();
         display.setConnStatus(true);
       }
       else {
@@ -115,6 +244,51 @@ void loop() {
       }
       break;
   }
+
+  // nothing more to do until the next deadline, or until new input arrives
+  idle.sleep(idleTime(), wakePending);
+}
+
+uint32_t idleTime() {
+
+  uint32_t timeout = sensor.idleTime();
+
+  timeout = min(timeout, display.idleTime());
+  timeout = min(timeout, commands.idleTime());
+
+  // queued output is handed off as the USB serial port frees up, but the
+  // port's state cannot be checked while asleep, so poll it periodically.
+  if (txQueue.pending() > 0) {
+    timeout = min(timeout, (uint32_t)TX_RETRY_US);
+  }
+  return timeout;
+}
+
+bool wakePending() {
+
+  // must not block, and must not touch the interrupt mask (see Idle_Loop)
+  return (Serial.available() > 0) || display.touchPending();
+}
+
+bool queueSensorDoc(TX_Queue_Class cls) {
+
+  static char txBuffer[TXQ_MESSAGE_MAX];
+
+  // reserve the last byte for the newline, which the serializer does not
+  // include but the cathys-drive Go parser requires as message delimiter.
+  size_t len = serializeJson(sensorDoc, txBuffer, TXQ_MESSAGE_MAX - 1);
+  txBuffer[len++] = '\n';
+
+  return txQueue.enqueue(txBuffer, len, cls);
+}
+
+bool queueDiagnostic() {
+
+  static char txBuffer[DIAG_LINE_MAX];
+
+  size_t len = diag.line(txBuffer);
+
+  return txQueue.enqueue(txBuffer, len, tqcDiagnostic);
 }
 
 Serial_Read_Result readSerial(char * const &input) {
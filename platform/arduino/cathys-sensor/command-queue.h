@@ -0,0 +1,125 @@
+// -----------------------------------------------------------------------------
+//
+//  the sequenced, acknowledged user command queue
+//
+// -----------------------------------------------------------------------------
+#if !defined(__COMMAND_QUEUE_H__)
+#define __COMMAND_QUEUE_H__
+
+#include <Arduino.h>
+
+// cathys-sensor project includes
+#include "sensor-display.h"
+#include "sensor-time.h"
+
+// general configuration
+#define CMDQ_SIZE             8 // user commands awaiting delivery
+#define CMDQ_RETRANSMIT_MS  100 // resend an unacknowledged command this often
+#define CMDQ_SEQUENCE_NONE    0 // never assigned, acknowledges nothing
+#define CMDQ_RETRANSMIT_ELAPSED(since) hasTimeElapsed((since), MS_TO_US(CMDQ_RETRANSMIT_MS))
+
+// delivers each user command to cathys-drive exactly once. commands are sent
+// one at a time (stop-and-wait) with a sequence number, and the oldest is
+// resent until cathys-drive returns its sequence number on the downlink. the
+// next command is sent as soon as the previous one is acknowledged.
+//
+// cathys-drive acts on a command only if its sequence number differs from the
+// last one it accepted, and always returns that last accepted number. since
+// the firmware may restart without cathys-drive knowing, the sequence is not
+// started until the first downlink message arrives, and then continues from
+// whatever cathys-drive last accepted.
+class Command_Queue {
+public:
+  Command_Queue()
+    : _head(0),
+      _count(0),
+      _sequence(CMDQ_SEQUENCE_NONE),
+      _synced(false),
+      _sent(false),
+      _sentTime(0),
+      _transmissions(0),
+      _dropped(0)
+    { /* constructor empty */ }
+
+  // returns false (and counts the command as dropped) if the queue is full
+  bool push(User_Command command) {
+    if (_count >= CMDQ_SIZE) {
+      ++_dropped;
+      return false;
+    }
+    _command[(_head + _count) % CMDQ_SIZE] = command;
+    ++_count;
+    return true;
+  }
+
+  // returns the command that should be (re)sent right now along with its
+  // sequence number, or ucmdNONE if nothing is due.
+  User_Command due(uint8_t &sequence) const {
+    if (!_synced || 0 == _count) {
+      return ucmdNONE;
+    }
+    if (_sent && !CMDQ_RETRANSMIT_ELAPSED(_sentTime)) {
+      return ucmdNONE;
+    }
+    sequence = _sequence;
+    return _command[_head];
+  }
+
+  // records that the command returned by due() was handed off for sending
+  void didSend() {
+    _sent     = true;
+    _sentTime = timestampNow();
+    ++_transmissions;
+  }
+
+  // handles the sequence number returned on every downlink message
+  void acknowledge(uint8_t sequence) {
+    if (!_synced) {
+      _sequence = _next(sequence);
+      _synced   = true;
+      return;
+    }
+    if (_count > 0 && sequence == _sequence) {
+      _head     = (_head + 1) % CMDQ_SIZE;
+      _sequence = _next(_sequence);
+      _sent     = false;
+      --_count;
+    }
+  }
+
+  // microseconds until due() will next return a command (UINT32_MAX if none
+  // is waiting to be sent)
+  uint32_t idleTime() const {
+    if (!_synced || 0 == _count) {
+      return UINT32_MAX;
+    }
+    if (!_sent) {
+      return 0;
+    }
+    uint32_t elapsed = timeElapsed(_sentTime);
+    return elapsed >= MS_TO_US(CMDQ_RETRANSMIT_MS) ? 0 : MS_TO_US(CMDQ_RETRANSMIT_MS) - elapsed;
+  }
+
+  inline size_t   pending()       const { return _count; }
+  inline bool     synced()        const { return _synced; }
+  inline uint32_t transmissions() const { return _transmissions; }
+  inline uint32_t dropped()       const { return _dropped; }
+
+private:
+  User_Command _command[CMDQ_SIZE];
+  size_t       _head;
+  size_t       _count;
+  uint8_t      _sequence; // sequence number of the command at _head
+  bool         _synced;
+  bool         _sent;     // the command at _head has been sent at least once
+  Timestamp    _sentTime;
+  uint32_t     _transmissions;
+  uint32_t     _dropped;
+
+  static inline uint8_t _next(uint8_t sequence) {
+    // wraps around, skipping CMDQ_SEQUENCE_NONE
+    return (UCHAR_MAX == sequence) ? CMDQ_SEQUENCE_NONE + 1 : sequence + 1;
+  }
+};
+
+#endif // !defined(__COMMAND_QUEUE_H__)
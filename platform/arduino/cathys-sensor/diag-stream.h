@@ -0,0 +1,153 @@
+// -----------------------------------------------------------------------------
+//
+//  the raw diode diagnostic stream (batched, delta-encoded sample packets)
+//
+// -----------------------------------------------------------------------------
+#if !defined(__DIAG_STREAM_H__)
+#define __DIAG_STREAM_H__
+
+#include <Arduino.h>
+
+// cathys-sensor project includes
+#include "cathys-sensor.h"
+
+// general configuration
+#define DIAG_BATCH_MAX       8 // most frames that can be batched per packet
+#define DIAG_LINE_PREFIX   '@' // distinguishes packets from the JSON messages
+
+// each packet is a single text line so that it can share the serial link with
+// the JSON messages (which cathys-drive recognizes by their braces):
+//
+//   '@' base64( header, frame[0], delta[1], ..., delta[count-1] ) '\n'
+//
+// header:   sequence (u8), frame count (u8), diode count (u8, NUM_IR_DIODE)
+// frame[0]: timestamp in microseconds (u32), NUM_IR_DIODE raw values (u16 each)
+// delta[i]: time since frame[i-1] (varint), then for each diode the change in
+//           raw value since frame[i-1] (zigzag varint)
+//
+// multi-byte fixed-width fields are little-endian. varints are LEB128.
+#define DIAG_VARINT_MAX      3 // bytes, enough for any delta of a 14-bit value
+                               // and time deltas up to ~2 seconds
+#define DIAG_HEADER_SIZE     3
+#define DIAG_FRAME_SIZE      (sizeof(uint32_t) + NUM_IR_DIODE * sizeof(uint16_t))
+#define DIAG_DELTA_SIZE_MAX  ((1 + NUM_IR_DIODE) * DIAG_VARINT_MAX)
+#define DIAG_PACKET_MAX      (DIAG_HEADER_SIZE + DIAG_FRAME_SIZE + (DIAG_BATCH_MAX - 1) * DIAG_DELTA_SIZE_MAX)
+#define DIAG_LINE_MAX        (1 + 4 * ((DIAG_PACKET_MAX + 2) / 3) + 1)
+
+typedef struct {
+  Timestamp time;
+  int16_t   value[NUM_IR_DIODE];
+} Diagnostic_Frame;
+
+class Diagnostic_Stream {
+public:
+  Diagnostic_Stream()
+    : _batchSize(0),
+      _count(0),
+      _sequence(0)
+    { /* constructor empty */ }
+
+  // a batch size of 0 disables the stream. larger batches cost fewer bytes per
+  // frame on the link, at the expense of latency.
+  void setBatchSize(uint8_t batchSize) {
+    if (batchSize > DIAG_BATCH_MAX) { batchSize = DIAG_BATCH_MAX; }
+    if (batchSize != _batchSize) {
+      _batchSize = batchSize;
+      _count     = 0; // discard any partial batch
+    }
+  }
+
+  inline bool    enabled()   const { return _batchSize > 0; }
+  inline uint8_t batchSize() const { return _batchSize; }
+
+  // appends the sensor's current raw frame. returns true once a full batch has
+  // been collected and is ready to be retrieved with line().
+  bool add(const Cathys_Sensor &sensor, Timestamp time) {
+    if (!enabled()) {
+      return false;
+    }
+    if (_count >= _batchSize) {
+      _count = 0; // previous batch was retrieved (or abandoned)
+    }
+    Diagnostic_Frame &frame = _frame[_count++];
+    frame.time = time;
+    for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
+      frame.value[i] = sensor.value(i);
+    }
+    return _count >= _batchSize;
+  }
+
+  // encodes the current batch as a newline-terminated packet line into buf,
+  // which must hold at least DIAG_LINE_MAX bytes. returns its length.
+  size_t line(char *buf) {
+    uint8_t packet[DIAG_PACKET_MAX];
+    size_t  n = 0;
+
+    packet[n++] = _sequence++;
+    packet[n++] = _count;
+    packet[n++] = NUM_IR_DIODE;
+    n += _putFixed(&packet[n], _frame[0].time, sizeof(uint32_t));
+    for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
+      n += _putFixed(&packet[n], (uint16_t)_frame[0].value[i], sizeof(uint16_t));
+    }
+    for (size_t f = 1; f < _count; ++f) {
+      n += _putVarint(&packet[n], _frame[f].time - _frame[f - 1].time);
+      for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
+        int32_t delta = (int32_t)_frame[f].value[i] - _frame[f - 1].value[i];
+        n += _putVarint(&packet[n], ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));
+      }
+    }
+    _count = 0;
+
+    size_t len = 0;
+    buf[len++] = DIAG_LINE_PREFIX;
+    len += _base64(&buf[len], packet, n);
+    buf[len++] = '\n';
+    return len;
+  }
+
+private:
+  uint8_t          _batchSize;
+  uint8_t          _count;
+  uint8_t          _sequence; // lets the capture detect dropped packets
+  Diagnostic_Frame _frame[DIAG_BATCH_MAX];
+
+  static size_t _putFixed(uint8_t *dst, uint32_t v, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      dst[i] = (uint8_t)(v >> (8 * i));
+    }
+    return size;
+  }
+
+  static size_t _putVarint(uint8_t *dst, uint32_t v) {
+    size_t n = 0;
+    // time deltas are clamped so that every varint fits in DIAG_VARINT_MAX
+    if (v >= ((uint32_t)1 << (7 * DIAG_VARINT_MAX))) {
+      v = ((uint32_t)1 << (7 * DIAG_VARINT_MAX)) - 1;
+    }
+    while (v >= 0x80) {
+      dst[n++] = (uint8_t)(v | 0x80);
+      v >>= 7;
+    }
+    dst[n++] = (uint8_t)v;
+    return n;
+  }
+
+  static size_t _base64(char *dst, uint8_t const *src, size_t size) {
+    static char const alphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t n = 0;
+    for (size_t i = 0; i < size; i += 3) {
+      uint32_t v = (uint32_t)src[i] << 16;
+      if (i + 1 < size) { v |= (uint32_t)src[i + 1] << 8; }
+      if (i + 2 < size) { v |= (uint32_t)src[i + 2]; }
+      dst[n++] = alphabet[(v >> 18) & 0x3F];
+      dst[n++] = alphabet[(v >> 12) & 0x3F];
+      dst[n++] = (i + 1 < size) ? alphabet[(v >> 6) & 0x3F] : '=';
+      dst[n++] = (i + 2 < size) ? alphabet[v & 0x3F]        : '=';
+    }
+    return n;
+  }
+};
+
+#endif // !defined(__DIAG_STREAM_H__)
@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------
+//
+//  the power-aware idle between loop iterations (sleep until next deadline)
+//
+// -----------------------------------------------------------------------------
+#if !defined(__IDLE_LOOP_H__)
+#define __IDLE_LOOP_H__
+
+#include <Arduino.h>
+#include <climits>
+
+// cathys-sensor project includes
+#include "sensor-time.h"
+
+// general configuration
+#define IDLE_SLEEP_MIN_US     50 // shorter idle times are not worth a timer
+#define IDLE_SLEEP_MAX_US 100000 // longest single sleep
+#define IDLE_REPORT_MS      1000 // duty cycle is measured over this window
+
+// sleeps the core with WFI (wait for interrupt) until the earliest deadline
+// of any component, as given by the caller, or until an interrupt delivers new
+// input (USB serial RX/TX, the touch controller IRQ). a one-shot PIT interval
+// timer wakes the core at the deadline itself, so no deadline is serviced any
+// later than it would be by spinning.
+//
+// the core also wakes on every SysTick (1 kHz), which cannot be stopped since
+// millis() and micros() depend on it; each such wake-up only re-checks for
+// input and goes back to sleep.
+class Idle_Loop {
+public:
+  Idle_Loop()
+    : _windowStart(0),
+      _windowSleep(0),
+      _dutyCycle(100.0),
+      _dutyCycleUpdated(false)
+    { /* constructor empty */ }
+
+  void begin() {
+    _windowStart = timestampNow();
+    _windowSleep = 0;
+  }
+
+  // sleeps for at most timeoutUS, returning early as soon as pending() (which
+  // is called with interrupts disabled, so must not block) returns true.
+  void sleep(uint32_t timeoutUS, bool (*pending)()) {
+    if (timeoutUS > IDLE_SLEEP_MAX_US) { timeoutUS = IDLE_SLEEP_MAX_US; }
+
+    // without a timer (no PIT channel free, or the period rejected) nothing
+    // would wake the core at the deadline, so the caller simply spins instead.
+    _expired() = false;
+    if (timeoutUS >= IDLE_SLEEP_MIN_US && _timer.begin(_wake, timeoutUS)) {
+      Timestamp start = timestampNow();
+      for (;;) {
+        // the deadline is also checked against the clock, which SysTick wakes
+        // us to see at least every millisecond, in case the timer's interrupt
+        // is lost. this must come before masking, since micros() unmasks.
+        if (timeElapsed(start) >= timeoutUS) {
+          break;
+        }
+        // the condition is checked with interrupts masked, and WFI still wakes
+        // on an interrupt that becomes pending while masked. so an interrupt
+        // arriving between the check and the WFI cannot be slept through.
+        __disable_irq();
+        if (_expired() || pending()) {
+          __enable_irq();
+          break;
+        }
+        asm volatile("wfi");
+        __enable_irq(); // the interrupt that woke us is serviced here
+      }
+      _timer.end();
+      _windowSleep += timeElapsed(start);
+    }
+
+    uint32_t window = timeElapsed(_windowStart);
+    if (window >= MS_TO_US(IDLE_REPORT_MS)) {
+      _dutyCycle   = 100.0 * (1.0 - (float)_windowSleep / window);
+      _windowStart = timestampNow();
+      _windowSleep = 0;
+      _dutyCycleUpdated = true;
+    }
+  }
+
+  // percentage of time spent awake over the last completed report window
+  inline float dutyCycle() const { return _dutyCycle; }
+
+  // true once a new duty cycle has been measured, until it is reported
+  inline bool dutyCycleUpdated() const { return _dutyCycleUpdated; }
+  inline void dutyCycleReported() { _dutyCycleUpdated = false; }
+
+private:
+  IntervalTimer _timer;
+  Timestamp     _windowStart;
+  uint32_t      _windowSleep; // microseconds slept in the current window
+  float         _dutyCycle;
+  bool          _dutyCycleUpdated;
+
+  static volatile bool &_expired() {
+    static volatile bool expired = false;
+    return expired;
+  }
+
+  static void _wake() { // interval timer ISR, fires once per sleep
+    _expired() = true;
+  }
+};
+
+#endif // !defined(__IDLE_LOOP_H__)
@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------
+//
+//  the adaptive ambient noise floor and signal detector
+//
+// -----------------------------------------------------------------------------
+#if !defined(__NOISE_FLOOR_H__)
+#define __NOISE_FLOOR_H__
+
+#include <Arduino.h>
+
+// cathys-sensor project includes
+#include "oversample.h"
+#include "sensor-time.h"
+
+// general configuration
+#define NOISE_FLOOR_RISE_MS     500 // floor time constant toward dimmer readings
+#define NOISE_FLOOR_FALL_MS    5000 // floor time constant toward brighter noise
+#define NOISE_FLOOR_HOLD_MS  300000 // floor time constant toward a brighter signal
+#define NOISE_SPREAD_MS        2000 // spread time constant
+#define NOISE_SPREAD_MIN        2.0 // raw counts, about the quantization noise left
+#define NOISE_SPREAD_START     (8.0 * IR_SAMPLE_SCALE) // raw counts, until learned
+#define NOISE_OUTLIER           3.0 // deviations beyond this many spreads are not noise
+// a beacon lights only a few neighbouring diodes. when more than this fraction
+// of all diodes read brighter than their floors at once, the room itself got
+// brighter, and the floors follow it as quickly as they follow it darkening.
+#define NOISE_AMBIENT_SHIFT    0.75
+
+// a signal is acquired once the smoothed signal-to-noise ratio rises above
+// IR_SNR_ACQUIRE, and is then held until it falls below IR_SNR_RELEASE.
+#define IR_SNR_ACQUIRE          6.0
+#define IR_SNR_RELEASE          3.0
+#define IR_SNR_SMOOTHING_MS     100 // time constant of the smoothed ratio
+
+// returns the weight of a new sample in an exponential average with the given
+// time constant, when dt microseconds have passed since the previous sample.
+static inline float ewmaWeight(uint32_t dt, uint32_t tauMS) {
+  float weight = (float)dt / MS_TO_US(tauMS);
+  return weight < 1.0 ? weight : 1.0;
+}
+
+// tracks one diode's ambient level and the spread of its readings about that
+// level, both in raw ADC counts (where smaller is brighter).
+//
+// the level follows dimmer readings quickly and brighter ones slowly, so that
+// it settles toward the dim side of the ambient noise (a streaming upper
+// quantile). readings that stand out from the noise (the beacon) barely move
+// it at all, so a beacon can be tracked indefinitely without being mistaken
+// for ambient light; when the beacon goes away, or the room gets darker, the
+// floor recovers within a second. the spread is the mean absolute deviation
+// from the level, learned from the noise only, so that a signal does not
+// inflate its own noise estimate.
+class Noise_Floor {
+public:
+  Noise_Floor()
+    { reset(); }
+
+  void reset() {
+    _level  = 0.0;
+    _spread = NOISE_SPREAD_START;
+    _primed = false;
+  }
+
+  // feeds the newest reading, dt microseconds after the previous one. if
+  // ambientShift, the whole room got brighter, and so does the floor.
+  void update(int16_t value, uint32_t dt, bool ambientShift) {
+    if (!_primed) {
+      _level  = value;
+      _primed = true;
+      return;
+    }
+    float    deviation = (float)value - _level;
+    bool     outlier   = fabs(deviation) > NOISE_OUTLIER * _spread;
+    uint32_t tau;
+    if (deviation > 0.0 || ambientShift) {
+      tau = NOISE_FLOOR_RISE_MS;
+    }
+    else {
+      tau = outlier ? NOISE_FLOOR_HOLD_MS : NOISE_FLOOR_FALL_MS;
+    }
+    _level += ewmaWeight(dt, tau) * deviation;
+
+    if (!outlier) {
+      _spread += ewmaWeight(dt, NOISE_SPREAD_MS) * (fabs(deviation) - _spread);
+      if (_spread < NOISE_SPREAD_MIN) { _spread = NOISE_SPREAD_MIN; }
+    }
+  }
+
+  // how many spreads brighter than the ambient level the given reading is
+  inline float snr(int16_t value) const {
+    return _primed ? (_level - (float)value) / _spread : 0.0;
+  }
+  inline float level()  const { return _level; }
+  inline float spread() const { return _spread; }
+
+private:
+  float _level;  // ambient reading (raw counts)
+  float _spread; // mean absolute deviation about _level (raw counts)
+  bool  _primed; // false until the first reading
+};
+
+// decides whether a signal is present from the signal-to-noise ratio of each
+// frame. the ratio is smoothed so that a single noisy frame cannot toggle the
+// decision, and the separate acquire and release thresholds (hysteresis) keep
+// a signal near the threshold from flickering on and off.
+class Signal_Detector {
+public:
+  Signal_Detector()
+    { reset(); }
+
+  void reset() {
+    _snr    = 0.0;
+    _signal = false;
+  }
+
+  // feeds the newest frame's ratio, dt microseconds after the previous frame,
+  // and returns whether a signal is present.
+  bool update(float snr, uint32_t dt) {
+    _snr += ewmaWeight(dt, IR_SNR_SMOOTHING_MS) * (snr - _snr);
+    if (_signal) {
+      _signal = _snr >= IR_SNR_RELEASE;
+    }
+    else {
+      _signal = _snr >= IR_SNR_ACQUIRE;
+    }
+    return _signal;
+  }
+
+  inline float snr()    const { return _snr; }
+  inline bool  signal() const { return _signal; }
+
+private:
+  float _snr;    // smoothed signal-to-noise ratio
+  bool  _signal;
+};
+
+#endif // !defined(__NOISE_FLOOR_H__)
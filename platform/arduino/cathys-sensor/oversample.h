@@ -0,0 +1,69 @@
+// -----------------------------------------------------------------------------
+//
+//  the oversampling IR acquisition stage (boxcar decimation)
+//
+// -----------------------------------------------------------------------------
+#if !defined(__OVERSAMPLE_H__)
+#define __OVERSAMPLE_H__
+
+#include <Arduino.h>
+
+// general configuration
+#define IR_ADC_RESOLUTION  12 // bits per conversion
+#define IR_ADC_AVERAGING    4 // conversions averaged in hardware per read
+#define IR_OVERSAMPLE_BITS  1 // bits of resolution gained in software
+
+// each sample delivered to Cathys_Sensor is the decimated sum of IR_OVERSAMPLE
+// reads of the same diode. given enough noise to dither between codes, every
+// 4x oversampling gains one bit of resolution.
+#define IR_OVERSAMPLE      (1 << (2 * IR_OVERSAMPLE_BITS))
+#define IR_SAMPLE_BITS     (IR_ADC_RESOLUTION + IR_OVERSAMPLE_BITS)
+#define IR_SAMPLE_MIN      0
+#define IR_SAMPLE_MAX      ((1 << IR_SAMPLE_BITS) - 1)
+// thresholds on raw values were all tuned with 10-bit analogRead() values, so
+// they are written in 10-bit counts and scaled by this many sample counts each.
+#define IR_SAMPLE_SCALE    (1 << (IR_SAMPLE_BITS - 10))
+
+// samples are int16_t, and fit the diagnostic stream's 3-byte varint deltas
+static_assert(IR_SAMPLE_BITS >= 10 && IR_SAMPLE_BITS <= 14,
+  "unsupported IR sample resolution");
+
+// sums the reads of each channel (integrate) and hands out one rounded sample
+// per Factor reads (dump). this is a first-order CIC decimator, i.e. a boxcar
+// average: the cheapest filter that removes the extra reads' noise, using one
+// addition per read and no multiplications. all state is held in place.
+template <size_t Channels, size_t Factor, uint8_t Shift>
+class Boxcar_Decimator {
+  // each sum of Factor reads keeps Shift bits more than a single read, which
+  // takes Factor = 4^Shift reads (the noise falls by half per doubling of bits)
+  static_assert(Factor == ((size_t)1 << (2 * Shift)),
+    "decimation factor must be 4 to the power of the extra bits kept");
+
+public:
+  Boxcar_Decimator()
+    { reset(); }
+
+  void reset() {
+    for (size_t i = 0; i < Channels; ++i) {
+      _sum[i] = 0;
+    }
+  }
+
+  inline void add(size_t channel, uint16_t value) {
+    _sum[channel] += value;
+  }
+
+  // returns the channel's sample once Factor reads have been added, rounded to
+  // nearest, and starts the channel's next sum.
+  inline uint16_t take(size_t channel) {
+    uint32_t sum = _sum[channel];
+    _sum[channel] = 0;
+    return (uint16_t)((sum + _HALF) >> Shift);
+  }
+
+private:
+  static uint32_t const _HALF = ((uint32_t)1 << Shift) >> 1; // rounds to nearest
+  uint32_t _sum[Channels];
+};
+
+#endif // !defined(__OVERSAMPLE_H__)
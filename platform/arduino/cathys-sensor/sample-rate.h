@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------
+//
+//  the adaptive IR sampling-rate controller
+//
+// -----------------------------------------------------------------------------
+#if !defined(__SAMPLE_RATE_H__)
+#define __SAMPLE_RATE_H__
+
+#include <Arduino.h>
+
+// cathys-sensor project includes
+#include "oversample.h"
+#include "sensor-time.h"
+
+// general configuration
+#define IR_POLL_MIN_US           4000 // fastest poll period (250 Hz)
+#define IR_POLL_MAX_US          20000 // slowest poll period (50 Hz)
+#define IR_POLL_START_US        10000 // poll period at boot (100 Hz)
+#define IR_RATE_BACKOFF_US       1000 // period lengthened per static frame
+
+// per-frame activity is the absolute change in raw value of the brightest
+// diode (in 10-bit counts, see IR_SAMPLE_SCALE), plus IR_RATE_BEARING_WEIGHT
+// for each degree its bearing moved by. it is smoothed (EWMA) before being
+// compared to the thresholds, so that a single noisy frame does not change
+// the rate.
+#define IR_RATE_BEARING_WEIGHT   1.78 // activity per degree (64 per 36° diode step)
+#define IR_RATE_SMOOTHING        0.25 // weight of the newest frame in the average
+#define IR_RATE_FAST_ACTIVITY    24.0 // above this the period is halved
+#define IR_RATE_SLOW_ACTIVITY     6.0 // below this the period is lengthened
+
+// decides how long to wait before the next IR poll. the rate rises quickly
+// (the period halves) as soon as the signal starts moving, so that a turn is
+// tracked with the least latency, and decays slowly (the period grows by a
+// fixed step) once it settles. since activity is measured per frame, a signal
+// changing at a constant speed settles at the rate where the change per frame
+// sits between the two thresholds.
+class Sample_Rate_Controller {
+public:
+  Sample_Rate_Controller()
+    { reset(); }
+
+  void reset() {
+    _period   = IR_POLL_START_US;
+    _activity = 0.0;
+    _primed   = false;
+  }
+
+  // feeds the brightest diode (bearing in degrees and raw value) of the newest
+  // frame, and returns the period to wait before polling again.
+  uint32_t update(int16_t bearing, int16_t value) {
+    if (_primed) {
+      int16_t turn = abs(bearing - _lastBearing);
+      if (turn > 180) { turn = 360 - turn; } // the shorter way around
+      float change =
+        fabs((float)value - _lastValue) / IR_SAMPLE_SCALE +
+        (float)turn * IR_RATE_BEARING_WEIGHT;
+      _activity += IR_RATE_SMOOTHING * (change - _activity);
+
+      if (_activity > IR_RATE_FAST_ACTIVITY) {
+        _period /= 2;
+        if (_period < IR_POLL_MIN_US) { _period = IR_POLL_MIN_US; }
+      }
+      else if (_activity < IR_RATE_SLOW_ACTIVITY) {
+        _period += IR_RATE_BACKOFF_US;
+        if (_period > IR_POLL_MAX_US) { _period = IR_POLL_MAX_US; }
+      }
+    }
+    _lastBearing = bearing;
+    _lastValue   = value;
+    _primed      = true;
+    return _period;
+  }
+
+  inline uint32_t period()   const { return _period; }
+  inline float    activity() const { return _activity; }
+
+private:
+  uint32_t _period;
+  float    _activity;
+  bool     _primed; // false until there is a previous frame to compare with
+  int16_t  _lastBearing;
+  int16_t  _lastValue;
+};
+
+#endif // !defined(__SAMPLE_RATE_H__)
@@ -13,18 +13,18 @@
 #include <font_Arial.h> // from ILI9341_t3
 #include <XPT2046_Touchscreen.h>
 
-#define MILLIS_TIME_ELAPSED(since, interval) (millis() - (since) >= (interval))
+// cathys-sensor project includes
+#include "button-bitmaps.h" // generated by cathys-sensor-assets
+#include "cathys-sensor.h"
+#include "sensor-time.h"
+#include "touch-calibration.h"
+
+#define MILLIS_TIME_ELAPSED(since, interval) hasTimeElapsed((since), MS_TO_US(interval))
 
 // general configuration
 #define REFRESH_RATE_MS 100 // frequency to perform screen updates (milliseconds)
 #define REFRESH_RATE_ELAPSED(since) MILLIS_TIME_ELAPSED((since), REFRESH_RATE_MS)
 
-// the time interval in which we continue spewing out the user command. once
-// expired, if another hasn't appeared, the command resets to NONE. you may
-// need to adjust this based on the speed/freq with which you can read the UART.
-#define USER_COMMAND_DURATION_MS 250
-#define USER_COMMAND_EXPIRED(since) MILLIS_TIME_ELAPSED((since), USER_COMMAND_DURATION_MS)
-
 // pins used on the Teensy 3.6
 #define UNUSED_PIN        255 //
 #define SPI_MOSI_PIN       11 // TFT LCD and touchscreen are on the first SPI
@@ -94,6 +94,12 @@
 
 #define GFX_BUTTON_TEXT_SIZE            2
 
+// blit each button state from its pre-rendered bitmap (see button-bitmaps.h)
+// in a single SPI write, rather than drawing the frame and label through the
+// font engine. regenerate the bitmaps with cathys-sensor-assets whenever the
+// button geometry, labels, or colors are changed.
+#define GFX_BUTTON_BITMAPS
+
 typedef enum {
   // orientation is based on location of the board pins, and the ordinal value
   // of each enumeration corresponds to the TFT class's rotation value
@@ -106,22 +112,12 @@ typedef enum {
 } Display_Orientation;
 #define DEFAULT_ORIENTATION sdoPortrait
 
-// touch coordinate map calibration values. adjust as needed.
-#define XPT2046_X_LO 150
-#define XPT2046_X_HI 3800
-#define XPT2046_Y_LO 325
-#define XPT2046_Y_HI 4000
-
-#define MAP_2D_PORTRAIT(x, y)                                        \
-  Point2D(                                                           \
-    (int16_t)map((x), XPT2046_X_LO, XPT2046_X_HI, SCREEN_WIDTH,  0), \
-    (int16_t)map((y), XPT2046_Y_LO, XPT2046_Y_HI, SCREEN_HEIGHT, 0)  \
-  )
-#define MAP_2D_LANDSCAPE(x, y)                                       \
-  Point2D(                                                           \
-    (int16_t)map((x), XPT2046_X_LO, XPT2046_X_HI, SCREEN_HEIGHT, 0), \
-    (int16_t)map((y), XPT2046_Y_LO, XPT2046_Y_HI, SCREEN_WIDTH,  0)  \
-  )
+// interactive touch calibration, run at startup if the screen is being touched
+#define TOUCH_CAL_TARGET_RADIUS  8 // pixels, size of the crosshair
+#define TOUCH_CAL_NUM_SAMPLES   16 // raw samples averaged per target
+#define TOUCH_CAL_SETTLE_MS     50 // debounce between press/release polls
+#define TOUCH_CAL_FG_COLOR      ILI9341_CYAN
+#define TOUCH_CAL_BG_COLOR      GFX_BACKGROUND_COLOR
 
 class Point2D {
 public:
@@ -137,31 +133,12 @@ public:
       _initialized(point._initialized)
     { /* copy-constructor empty */ }
 
-  Point2D(const TS_Point &point, Display_Orientation orientation)
+  Point2D(const TS_Point &point, const Affine_Transform &transform)
     : x(0),
       y(0),
-      _initialized(false) {
+      _initialized(true) {
     // convert the touchscreen coordinates to actual pixel coordinates
-    Point2D *m = nullptr;
-    orientation = (Display_Orientation)(orientation % sdoCOUNT);
-    switch (orientation) {
-      case sdoPortrait:
-      case sdoPortraitFlip:
-        m = new MAP_2D_PORTRAIT(point.x, point.y);
-        break;
-      case sdoLandscape:
-      case sdoLandscapeFlip:
-        m = new MAP_2D_LANDSCAPE(point.x, point.y);
-        break;
-      default:
-        break;
-    }
-    if (nullptr != m) {
-      x = m->x;
-      y = m->y;
-      delete m;
-      _initialized = true;
-    }
+    transform.apply(point.x, point.y, x, y);
   }
 
   inline bool operator ==(const Point2D &point) const {
@@ -182,8 +159,8 @@ private:
   bool _initialized;
 };
 
-#define NUM_IR_DIODE 6
-const Point2D originLED[NUM_IR_DIODE] = {
+// one array of diodes is shown at a time, whichever faces the signal
+const Point2D originLED[IR_DIODES_PER_ARRAY] = {
   Point2D(
     GFX_MIDPT_X         + ((-1.0/*cos(180°)*/)                               * GFX_SENSOR_SUM_RADIUS),
     GFX_SENSOR_ORIGIN_Y - (( 0.0/*sin(180°)*/)                               * GFX_SENSOR_SUM_RADIUS)
@@ -214,6 +191,16 @@ class Sensor_Display;
 typedef void (Sensor_Display::*Button_Callback)();
 #define CALL_MEMBER_FN(obj, mth)  ((obj).*(mth))
 
+typedef enum {
+  // ordinal value of each enumeration corresponds to the second index of the
+  // generated buttonBitmap table
+  bstNONE = -1,
+  bstEnabled,
+  bstDisabled,
+  bstTouched,
+  bstCOUNT
+} Button_State;
+
 class Round_Button {
 public:
   Round_Button()
@@ -231,7 +218,8 @@ public:
       _bgTouchedColor(0),
       _wasTouched(false),
       _touchDown(nullptr),
-      _touchUp(nullptr)
+      _touchUp(nullptr),
+      _bitmap(nullptr)
     { /* constructor empty */ }
 
   Round_Button(char const *text, int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius, Button_Callback touchDown = nullptr, Button_Callback touchUp = nullptr)
@@ -249,7 +237,8 @@ public:
       _bgTouchedColor(GFX_BUTTON_TOUCHED_BG_COLOR),
       _wasTouched(true),
       _touchDown(touchDown),
-      _touchUp(touchUp)
+      _touchUp(touchUp),
+      _bitmap(nullptr)
     { /* constructor empty */ }
 
   Round_Button(char const *text, const Point2D &origin, int16_t width, int16_t height, int16_t radius, Button_Callback touchDown = nullptr, Button_Callback touchUp = nullptr)
@@ -267,7 +256,8 @@ public:
       _bgTouchedColor(GFX_BUTTON_TOUCHED_BG_COLOR),
       _wasTouched(true),
       _touchDown(touchDown),
-      _touchUp(touchUp)
+      _touchUp(touchUp),
+      _bitmap(nullptr)
     { /* constructor empty */ }
 
   Round_Button(const Round_Button &button)
@@ -285,7 +275,8 @@ public:
       _bgTouchedColor(button._bgTouchedColor),
       _wasTouched(button._wasTouched),
       _touchDown(button._touchDown),
-      _touchUp(button._touchUp)
+      _touchUp(button._touchUp),
+      _bitmap(button._bitmap)
     { /* copy-constructor empty */ }
 
   void setColors(
@@ -301,6 +292,11 @@ public:
     _bgTouchedColor  = bgTouchedColor;
   }
 
+  void setBitmaps(Button_Bitmap const *bitmap) {
+    // expects one bitmap per Button_State
+    _bitmap = bitmap;
+  }
+
   bool contains(const Point2D &point) const {
     return
       (point.x >= _origin.x && point.x <= _origin.x + _width)
@@ -308,7 +304,7 @@ public:
       (point.y >= _origin.y && point.y <= _origin.y + _height);
   }
 
-  void draw(ILI9341_t3 &tft, XPT2046_Touchscreen &touch, Sensor_Display &disp) {
+  void draw(ILI9341_t3 &tft, XPT2046_Touchscreen &touch, const Touch_Calibration &calibration, Sensor_Display &disp) {
 
     bool screenTouched = touch.touched();
     bool buttonTouched = false;
@@ -321,7 +317,7 @@ public:
       TS_Point touchPoint = touch.getPoint();
 
       // determine the actual screen coordinates of the touch event
-      Point2D point = Point2D(touchPoint, (Display_Orientation)tft.getRotation());
+      Point2D point = Point2D(touchPoint, calibration.transform(tft.getRotation()));
 
       // always update the pressure, regardless if it is a new touch or not
       _pressure = touchPoint.z;
@@ -337,7 +333,7 @@ public:
         // the NEW button selection.
         if (!_wasTouched) {
           //Serial.print("    button start "); Serial.println(_text);
-          _draw(tft, _text, GFX_BUTTON_TEXT_SIZE, _fgTouchedColor, _bgTouchedColor);
+          _drawState(tft, bstTouched);
         }
         else {
           //Serial.print("        button hold "); Serial.println(_text);
@@ -356,7 +352,7 @@ public:
         // register this as a button tap.
         if (_wasTouched) {
           //Serial.print("    button leave "); Serial.println(_text);
-          _draw(tft, _text, GFX_BUTTON_TEXT_SIZE, _fgEnabledColor, _bgEnabledColor);
+          _drawState(tft, bstEnabled);
         }
         else {
           //Serial.print("screen hold "); Serial.println(_text);
@@ -378,7 +374,7 @@ public:
       // which is handled as a screen touch event above.
       if (_wasTouched) {
         //Serial.print("            button release "); Serial.println(_text);
-        _draw(tft, _text, GFX_BUTTON_TEXT_SIZE, _fgEnabledColor, _bgEnabledColor);
+        _drawState(tft, bstEnabled);
         if (nullptr != _touchUp) {
           CALL_MEMBER_FN(disp, _touchUp)();
         }
@@ -406,6 +402,45 @@ private:
   Button_Callback _touchDown; // called while button is pressed
   Button_Callback _touchUp;   // called when button released
 
+  Button_Bitmap const *_bitmap; // pre-rendered states, or nullptr if none
+
+  void _drawState(ILI9341_t3 &tft, Button_State state) {
+#if defined(GFX_BUTTON_BITMAPS)
+    if (nullptr != _bitmap) {
+      _blit(tft, _bitmap[state]);
+      return;
+    }
+#endif
+    switch (state) {
+      case bstEnabled:
+        _draw(tft, _text, GFX_BUTTON_TEXT_SIZE, _fgEnabledColor, _bgEnabledColor);
+        break;
+      case bstDisabled:
+        _draw(tft, _text, GFX_BUTTON_TEXT_SIZE, _fgDisabledColor, _bgDisabledColor);
+        break;
+      case bstTouched:
+        _draw(tft, _text, GFX_BUTTON_TEXT_SIZE, _fgTouchedColor, _bgTouchedColor);
+        break;
+      default:
+        break;
+    }
+  }
+
+  void _blit(ILI9341_t3 &tft, const Button_Bitmap &bitmap) {
+    // every button shares one scratch frame, sized for the largest bitmap
+    static uint16_t pixel[BUTTON_BITMAP_PIXELS_MAX];
+    uint16_t *p   = pixel;
+    uint16_t *end = pixel + (bitmap.width * bitmap.height);
+    // expand the (count, color) runs from flash, then push the entire frame
+    // to the TFT with a single SPI transaction.
+    for (size_t i = 0; i + 1 < bitmap.length; i += 2) {
+      uint16_t count = bitmap.rle[i];
+      uint16_t color = bitmap.rle[i + 1];
+      while (count-- > 0 && p < end) { *p++ = color; }
+    }
+    tft.writeRect(_origin.x, _origin.y, bitmap.width, bitmap.height, pixel);
+  }
+
   void _draw(ILI9341_t3 &tft, char const *text, uint8_t size, uint16_t fgColor, uint16_t bgColor) {
     static uint16_t w, h;
     // draw the outer button frame
@@ -455,9 +490,11 @@ public:
         _tft_rst_pin(tft_rst_pin),
         _touch_spi_cs_pin(touch_spi_cs_pin),
         _touch_irq_pin(touch_irq_pin),
-        _userCommandTime(0),
         _userCommand(ucmdNONE),
+        _userCommandEvent(ucmdNONE),
         _orientation(sdoNONE),
+        _refreshTime(0),
+        _touchActive(false),
         _tft(
           tft_spi_cs_pin,
           tft_spi_dc_pin,
@@ -472,32 +509,46 @@ public:
         ),
         _passiveButton(
           "Pasv", 2, 6, 76, 36, 5,
-          &Sensor_Display::passiveButtonDidTouch
+          &Sensor_Display::passiveButtonDidTouch,
+          &Sensor_Display::buttonDidRelease
         ),
         _safeButton(
           "Safe", 82, 6, 76, 36, 5,
-          &Sensor_Display::safeButtonDidTouch
+          &Sensor_Display::safeButtonDidTouch,
+          &Sensor_Display::buttonDidRelease
         ),
         _trackButton(
           "Track", 162, 6, 76, 36, 5,
-          &Sensor_Display::trackButtonDidTouch
+          &Sensor_Display::trackButtonDidTouch,
+          &Sensor_Display::buttonDidRelease
         ),
         _fullButton(
           "Full", 2, 52, 76, 36, 5,
-          &Sensor_Display::fullButtonDidTouch
+          &Sensor_Display::fullButtonDidTouch,
+          &Sensor_Display::buttonDidRelease
         ),
         _resetButton(
           "Reset", 82, 52, 76, 36, 5,
-          &Sensor_Display::resetButtonDidTouch
+          &Sensor_Display::resetButtonDidTouch,
+          &Sensor_Display::buttonDidRelease
         ),
         _offButton(
           "Off", 162, 52, 76, 36, 5,
-          &Sensor_Display::offButtonDidTouch
+          &Sensor_Display::offButtonDidTouch,
+          &Sensor_Display::buttonDidRelease
         ),
         _connStatus(false),
         _modeStatus(""),
         _battStatus(0)
   {
+    // pre-rendered bitmaps are indexed by the command each button issues
+    _passiveButton.setBitmaps(buttonBitmap[ucmdPassive]);
+    _safeButton.   setBitmaps(buttonBitmap[ucmdSafe]);
+    _trackButton.  setBitmaps(buttonBitmap[ucmdTrack]);
+    _fullButton.   setBitmaps(buttonBitmap[ucmdFull]);
+    _resetButton.  setBitmaps(buttonBitmap[ucmdReset]);
+    _offButton.    setBitmaps(buttonBitmap[ucmdOff]);
+
     // override the default colors for "Reset" and "Off" buttons
     _resetButton.setColors(
       GFX_CRITICAL_ENABLED_FG_COLOR,
@@ -520,6 +571,68 @@ public:
     _tft.fillScreen(GFX_BACKGROUND_COLOR);
     _touch.begin();
     setOrientation(orientation);
+    // use any stored calibration, but let the user redo it by holding a finger
+    // on the screen during startup.
+    _calibration.load();
+    if (_touch.touched()) {
+      calibrateTouch();
+    }
+  }
+
+  // interactive three-point touch calibration for the current orientation.
+  // blocks until all targets have been touched, then stores the result in
+  // EEPROM. returns false (keeping the previous calibration) if the touches
+  // could not be solved for, e.g. they were all in a line.
+  bool calibrateTouch() {
+    int16_t w = _tft.width();
+    int16_t h = _tft.height();
+    int32_t sx[3] = { w / 8,     w * 7 / 8, w / 2     };
+    int32_t sy[3] = { h / 8,     h / 2,     h * 7 / 8 };
+    int32_t rx[3], ry[3];
+
+    for (int i = 0; i < 3; ++i) {
+      _tft.fillScreen(TOUCH_CAL_BG_COLOR);
+      _tft.setTextColor(TOUCH_CAL_FG_COLOR);
+      _tft.setTextSize(2);
+      _tft.setCursor(8, h / 2 - 8);
+      _tft.print("Touch the target");
+      _tft.drawFastHLine(sx[i] - TOUCH_CAL_TARGET_RADIUS, sy[i], 2 * TOUCH_CAL_TARGET_RADIUS + 1, TOUCH_CAL_FG_COLOR);
+      _tft.drawFastVLine(sx[i], sy[i] - TOUCH_CAL_TARGET_RADIUS, 2 * TOUCH_CAL_TARGET_RADIUS + 1, TOUCH_CAL_FG_COLOR);
+      _tft.drawCircle(sx[i], sy[i], TOUCH_CAL_TARGET_RADIUS / 2, TOUCH_CAL_FG_COLOR);
+
+      // wait for the previous touch (or the startup touch) to be released
+      while (_touch.touched()) { delay(TOUCH_CAL_SETTLE_MS); }
+      while (!_touch.touched()) { delay(TOUCH_CAL_SETTLE_MS); }
+      delay(TOUCH_CAL_SETTLE_MS);
+
+      // average the raw position over several samples while held down
+      int32_t sumX = 0, sumY = 0, n = 0;
+      while (n < TOUCH_CAL_NUM_SAMPLES && _touch.touched()) {
+        TS_Point p = _touch.getPoint();
+        sumX += p.x;
+        sumY += p.y;
+        ++n;
+        delay(TOUCH_CAL_SETTLE_MS / 10);
+      }
+      if (0 == n) {
+        // released before we got any samples, try this target again
+        --i;
+        continue;
+      }
+      rx[i] = sumX / n;
+      ry[i] = sumY / n;
+    }
+    while (_touch.touched()) { delay(TOUCH_CAL_SETTLE_MS); }
+
+    _tft.fillScreen(GFX_BACKGROUND_COLOR);
+
+    Affine_Transform transform = _calibration.transform(_tft.getRotation());
+    if (!transform.solve(rx, ry, sx, sy)) {
+      return false;
+    }
+    _calibration.set(_tft.getRotation(), transform);
+    _calibration.save();
+    return true;
   }
 
   void setOrientation(Display_Orientation orientation) {
@@ -528,55 +641,68 @@ public:
   }
 
   void loop() {
-    static int lastTime = millis();
-    if (REFRESH_RATE_ELAPSED(lastTime)) {
+    // a new touch is handled right away instead of at the next refresh, so
+    // that sleeping between refreshes adds no latency to the buttons.
+    if (REFRESH_RATE_ELAPSED(_refreshTime) || touchPending()) {
       _drawSensor();
       _drawUI();
-      lastTime = millis();
+      _refreshTime = timestampNow();
+      _touchActive = _touch.tirqTouched();
+      if (!_touchActive) {
+        // a touch dragged off its button is released without a _touchUp event
+        buttonDidRelease();
+      }
     }
   }
 
-  User_Command userCommand() {
-    if (USER_COMMAND_EXPIRED(_userCommandTime)) {
-      _userCommand = ucmdNONE;
-    }
-    else {
-      switch (_userCommand) {
-        default:
-          break;
-      }
+  // true if the touch controller has signalled a touch that began since the
+  // last refresh. a touch that is being held does not count.
+  inline bool touchPending() {
+    return !_touchActive && _touch.tirqTouched();
+  }
+
+  inline uint32_t idleTime() { // microseconds until loop() has work to do
+    if (touchPending()) {
+      return 0;
     }
-    return _userCommand;
+    uint32_t elapsed = timeElapsed(_refreshTime);
+    return elapsed >= MS_TO_US(REFRESH_RATE_MS) ? 0 : MS_TO_US(REFRESH_RATE_MS) - elapsed;
+  }
+
+  // returns each new button press exactly once, then ucmdNONE until the next
+  User_Command userCommand() {
+    User_Command command = _userCommandEvent;
+    _userCommandEvent = ucmdNONE;
+    return command;
   }
 
   void passiveButtonDidTouch() {
-    _userCommandTime = millis();
-    _userCommand     = ucmdPassive;
+    _touchUserCommand(ucmdPassive);
   }
 
   void safeButtonDidTouch() {
-    _userCommandTime = millis();
-    _userCommand     = ucmdSafe;
+    _touchUserCommand(ucmdSafe);
   }
 
   void trackButtonDidTouch() {
-    _userCommandTime = millis();
-    _userCommand     = ucmdTrack;
+    _touchUserCommand(ucmdTrack);
   }
 
   void fullButtonDidTouch() {
-    _userCommandTime = millis();
-    _userCommand     = ucmdFull;
+    _touchUserCommand(ucmdFull);
   }
 
   void resetButtonDidTouch() {
-    _userCommandTime = millis();
-    _userCommand     = ucmdReset;
+    _touchUserCommand(ucmdReset);
   }
 
   void offButtonDidTouch() {
-    _userCommandTime = millis();
-    _userCommand     = ucmdOff;
+    _touchUserCommand(ucmdOff);
+  }
+
+  // the end of a press, whichever button it was
+  void buttonDidRelease() {
+    _userCommand = ucmdNONE;
   }
 
   void setConnStatus(bool stat) {
@@ -609,14 +735,18 @@ private:
   uint8_t _touch_spi_cs_pin;
   uint8_t _touch_irq_pin;
 
-  unsigned long _userCommandTime;
-  User_Command _userCommand;
+  User_Command _userCommand;      // button currently held, ucmdNONE once released
+  User_Command _userCommandEvent; // new press not yet taken by userCommand()
 
   Display_Orientation _orientation;
 
+  Timestamp _refreshTime; // when the screen was last drawn
+  bool      _touchActive; // screen was being touched as of the last refresh
+
   // local objects for which we define wrapper interfaces
   ILI9341_t3 _tft;
   XPT2046_Touchscreen _touch;
+  Touch_Calibration   _calibration;
 
   Round_Button _passiveButton;
   Round_Button _safeButton;
@@ -629,14 +759,24 @@ private:
   char     _modeStatus[8];
   uint16_t _battStatus;
 
+  void _touchUserCommand(User_Command command) {
+    // touch handlers are called on every refresh for as long as a button is
+    // held, so only the first call since the release of the last press (or a
+    // different button) is a new press.
+    if (command != _userCommand) {
+      _userCommandEvent = command;
+    }
+    _userCommand = command;
+  }
+
   void _drawUI() {
 
-    _passiveButton.draw(_tft, _touch, *this);
-    _safeButton.   draw(_tft, _touch, *this);
-    _trackButton.  draw(_tft, _touch, *this);
-    _fullButton.   draw(_tft, _touch, *this);
-    _resetButton.  draw(_tft, _touch, *this);
-    _offButton.    draw(_tft, _touch, *this);
+    _passiveButton.draw(_tft, _touch, _calibration, *this);
+    _safeButton.   draw(_tft, _touch, _calibration, *this);
+    _trackButton.  draw(_tft, _touch, _calibration, *this);
+    _fullButton.   draw(_tft, _touch, _calibration, *this);
+    _resetButton.  draw(_tft, _touch, _calibration, *this);
+    _offButton.    draw(_tft, _touch, _calibration, *this);
 
     _tft.fillRect(64, 92, 120, 58, GFX_STATUS_ACT_BG_COLOR);
     _tft.setTextColor(GFX_STATUS_ACT_FG_COLOR);
@@ -671,23 +811,26 @@ private:
     }
 
     _tft.setTextSize(2);
-    // write to screen the analog values being read from each IR sensor
-    for (size_t i = 0; i < NUM_IR_DIODE; ++i) {
+    // write to screen the analog values being read from each IR sensor of the
+    // array facing the signal
+    size_t first = _sensor.facingArray() * IR_DIODES_PER_ARRAY;
+    for (size_t j = 0; j < IR_DIODES_PER_ARRAY; ++j) {
+      size_t i = first + j;
       intensity = _sensor.intensity(i);
       snprintf(strbuf, GFX_STR_BUFSZ, "%d", (int)round(intensity));
 
       _tft.setCursor(
-        originLED[i].x - _tft.measureTextWidth(strbuf)  / 2,
-        originLED[i].y - _tft.measureTextHeight(strbuf) / 2
+        originLED[j].x - _tft.measureTextWidth(strbuf)  / 2,
+        originLED[j].y - _tft.measureTextHeight(strbuf) / 2
       );
 
       if (_sensor.valid(i) && _sensor.active(i)) {
         _tft.setTextColor(GFX_LED_DIODE_ACT_FG_COLOR);
-        _tft.fillCircle(originLED[i].x, originLED[i].y, GFX_LED_DIODE_RADIUS, GFX_LED_DIODE_ACT_BG_COLOR);
+        _tft.fillCircle(originLED[j].x, originLED[j].y, GFX_LED_DIODE_RADIUS, GFX_LED_DIODE_ACT_BG_COLOR);
       }
       else {
         _tft.setTextColor(GFX_LED_DIODE_RDY_FG_COLOR);
-        _tft.fillCircle(originLED[i].x, originLED[i].y, GFX_LED_DIODE_RADIUS, GFX_LED_DIODE_RDY_BG_COLOR);
+        _tft.fillCircle(originLED[j].x, originLED[j].y, GFX_LED_DIODE_RADIUS, GFX_LED_DIODE_RDY_BG_COLOR);
       }
       _tft.print(strbuf);
     }
@@ -0,0 +1,93 @@
+// -----------------------------------------------------------------------------
+//
+//  the timestamp type and loop timing statistics
+//
+// -----------------------------------------------------------------------------
+#if !defined(__SENSOR_TIME_H__)
+#define __SENSOR_TIME_H__
+
+#include <Arduino.h>
+#include <climits>
+
+// all firmware timestamps are microseconds from micros(), which wraps every
+// 2^32 us (about 71.6 minutes). elapsed times are computed with unsigned
+// subtraction, which yields the correct interval across a wrap as long as the
+// interval itself is shorter than the wrap period.
+typedef uint32_t Timestamp;
+
+#define MS_TO_US(ms)  ((uint32_t)(ms) * 1000UL)
+#define US_TO_MS(us)  ((uint32_t)(us) / 1000UL)
+
+inline Timestamp timestampNow() {
+  return micros();
+}
+
+inline uint32_t timeElapsed(Timestamp since, Timestamp now) {
+  return now - since;
+}
+
+inline uint32_t timeElapsed(Timestamp since) {
+  return timeElapsed(since, timestampNow());
+}
+
+inline bool hasTimeElapsed(Timestamp since, uint32_t intervalUS) {
+  return timeElapsed(since) >= intervalUS;
+}
+
+// streaming statistics (Welford) over a series of timing measurements, and
+// their deviation from a nominal value. the IR poll records how late each poll
+// ran past its scheduled time against a nominal of 0, since its period varies:
+// jitter() is then the standard deviation of that lateness (poll-jitter-us)
+// and jitterPeak() the worst lateness (poll-late-us).
+class Interval_Stats {
+public:
+  Interval_Stats(uint32_t nominalUS)
+    : _nominal(nominalUS)
+    { reset(); }
+
+  void reset() {
+    _count = 0;
+    _min   = UINT32_MAX;
+    _max   = 0;
+    _mean  = 0.0;
+    _m2    = 0.0;
+  }
+
+  void add(uint32_t intervalUS) {
+    ++_count;
+    if (intervalUS < _min) { _min = intervalUS; }
+    if (intervalUS > _max) { _max = intervalUS; }
+    float delta = (float)intervalUS - _mean;
+    _mean += delta / _count;
+    _m2   += delta * ((float)intervalUS - _mean);
+  }
+
+  inline uint32_t nominal()  const { return _nominal; }
+  inline uint32_t count()    const { return _count; }
+  inline uint32_t shortest() const { return _count > 0 ? _min : 0; }
+  inline uint32_t longest()  const { return _max; }
+  inline float    mean()     const { return _mean; }
+
+  // standard deviation of the measurements, in microseconds
+  inline float jitter() const {
+    return _count > 1 ? sqrtf(_m2 / (_count - 1)) : 0.0;
+  }
+
+  // worst-case deviation from the nominal value, in microseconds
+  inline uint32_t jitterPeak() const {
+    if (0 == _count) { return 0; }
+    uint32_t early = _nominal > _min ? _nominal - _min : 0;
+    uint32_t late  = _max > _nominal ? _max - _nominal : 0;
+    return early > late ? early : late;
+  }
+
+private:
+  uint32_t _nominal;
+  uint32_t _count;
+  uint32_t _min;
+  uint32_t _max;
+  float    _mean;
+  float    _m2;
+};
+
+#endif // !defined(__SENSOR_TIME_H__)
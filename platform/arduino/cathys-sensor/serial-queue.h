@@ -0,0 +1,236 @@
+// -----------------------------------------------------------------------------
+//
+//  the non-blocking transmit queue (on USB serial UART)
+//
+// -----------------------------------------------------------------------------
+#if !defined(__SERIAL_QUEUE_H__)
+#define __SERIAL_QUEUE_H__
+
+#include <Arduino.h>
+
+// general configuration
+#define TXQ_COMMAND_SIZE     256 // bytes reserved for queued command messages
+#define TXQ_DIAGNOSTIC_SIZE 2048 // bytes reserved for queued diagnostic messages
+#define TXQ_TELEMETRY_SIZE  1024 // bytes reserved for queued telemetry messages
+#define TXQ_MESSAGE_MAX      512 // largest single message (including newline)
+
+typedef enum {
+  // the class of a message determines which ring it is queued into and how it
+  // is treated when that ring is full.
+  tqcCommand,    // user commands -- never dropped by the queue
+  tqcDiagnostic, // raw sample streams -- subject to the overflow policy
+  tqcTelemetry,  // periodic sensor data -- subject to the overflow policy
+  tqcCOUNT
+} TX_Queue_Class;
+
+typedef enum {
+  // overflow policy applied to everything except commands. a newer telemetry
+  // message always supersedes an older one, so dropping the oldest is the
+  // default.
+  tqpDropOldest, // evict queued messages until the new message fits
+  tqpDropNewest, // discard the new message, keep what is already queued
+  tqpCOUNT
+} TX_Queue_Policy;
+#define DEFAULT_TX_QUEUE_POLICY tqpDropOldest
+
+// fixed-capacity ring of variable-length messages. each message is stored as a
+// 2-byte little-endian length followed by its payload, so that messages are
+// only ever added or removed whole.
+template <size_t N>
+class Message_Ring {
+public:
+  Message_Ring()
+    : _head(0),
+      _tail(0),
+      _used(0),
+      _count(0)
+    { /* constructor empty */ }
+
+  inline size_t used()  const { return _used; }
+  inline size_t room()  const { return N - _used; }
+  inline size_t count() const { return _count; }
+  inline bool   empty() const { return 0 == _count; }
+
+  // returns the number of ring bytes that a message of given length occupies
+  static inline size_t footprint(size_t len) {
+    return sizeof(uint16_t) + len;
+  }
+
+  bool push(uint8_t const *msg, uint16_t len) {
+    if (footprint(len) > room()) {
+      return false;
+    }
+    _put((uint8_t)(len & 0xFF));
+    _put((uint8_t)(len >> 8));
+    for (uint16_t i = 0; i < len; ++i) {
+      _put(msg[i]);
+    }
+    ++_count;
+    return true;
+  }
+
+  // removes the oldest message, copying its payload into dst (if provided,
+  // must have room for the full message). returns the payload length.
+  uint16_t pop(uint8_t *dst = nullptr) {
+    if (empty()) {
+      return 0;
+    }
+    uint16_t len = _get();
+    len |= (uint16_t)_get() << 8;
+    for (uint16_t i = 0; i < len; ++i) {
+      uint8_t b = _get();
+      if (nullptr != dst) { dst[i] = b; }
+    }
+    --_count;
+    return len;
+  }
+
+private:
+  uint8_t _buffer[N];
+  size_t  _head; // next index written
+  size_t  _tail; // next index read
+  size_t  _used;
+  size_t  _count;
+
+  inline void _put(uint8_t b) {
+    _buffer[_head] = b;
+    _head = (_head + 1) % N;
+    ++_used;
+  }
+
+  inline uint8_t _get() {
+    uint8_t b = _buffer[_tail];
+    _tail = (_tail + 1) % N;
+    --_used;
+    return b;
+  }
+};
+
+class Serial_Queue {
+public:
+  Serial_Queue(Stream &port, TX_Queue_Policy policy = DEFAULT_TX_QUEUE_POLICY)
+    : _port(port),
+      _policy(policy),
+      _wireLen(0),
+      _wirePos(0),
+      _bytesDropped(0),
+      _commandsDeferred(0)
+    { /* constructor empty */ }
+
+  void setPolicy(TX_Queue_Policy policy) {
+    _policy = policy;
+  }
+
+  // queues a complete message for transmission. never blocks. returns false if
+  // the message was not queued -- for telemetry and diagnostics this means it
+  // was dropped (and counted); for commands the caller still owns it and should
+  // retry later.
+  bool enqueue(char const *msg, size_t len, TX_Queue_Class cls) {
+    if (len > TXQ_MESSAGE_MAX) {
+      // cannot ever fit in the wire buffer, so this is always a drop
+      _bytesDropped += len;
+      return false;
+    }
+    switch (cls) {
+      case tqcCommand:
+        if (!_command.push((uint8_t const *)msg, len)) {
+          ++_commandsDeferred;
+          return false;
+        }
+        break;
+      case tqcDiagnostic:
+        if (!_pushDroppable(_diagnostic, msg, len)) {
+          return false;
+        }
+        break;
+      case tqcTelemetry:
+        if (!_pushDroppable(_telemetry, msg, len)) {
+          return false;
+        }
+        break;
+      default:
+        return false;
+    }
+    return true;
+  }
+
+  // writes as many queued bytes as the port will accept right now without
+  // blocking. commands are sent ahead of diagnostics, and diagnostics ahead of
+  // telemetry, but a message already on the wire is always finished first so
+  // that messages never interleave.
+  // returns the number of bytes written.
+  size_t pump() {
+    size_t written = 0;
+    int    avail   = _port.availableForWrite();
+    while (avail > 0) {
+      if (_wirePos >= _wireLen) {
+        if (!_command.empty()) {
+          _wireLen = _command.pop(_wire);
+        }
+        else if (!_diagnostic.empty()) {
+          _wireLen = _diagnostic.pop(_wire);
+        }
+        else if (!_telemetry.empty()) {
+          _wireLen = _telemetry.pop(_wire);
+        }
+        else {
+          break;
+        }
+        _wirePos = 0;
+      }
+      size_t n = _wireLen - _wirePos;
+      if (n > (size_t)avail) { n = avail; }
+      n = _port.write(_wire + _wirePos, n);
+      if (0 == n) {
+        break;
+      }
+      _wirePos += n;
+      written  += n;
+      avail    -= n;
+    }
+    return written;
+  }
+
+  inline size_t pending() const {
+    return (_wireLen - _wirePos) +
+      _command.used() + _diagnostic.used() + _telemetry.used();
+  }
+
+  // telemetry and diagnostic bytes discarded by the overflow policy
+  inline uint32_t bytesDropped() const { return _bytesDropped; }
+  // commands refused because their ring was full, each left to the caller
+  inline uint32_t commandsDeferred() const { return _commandsDeferred; }
+
+private:
+  Stream         &_port;
+  TX_Queue_Policy _policy;
+
+  Message_Ring<TXQ_COMMAND_SIZE>    _command;
+  Message_Ring<TXQ_DIAGNOSTIC_SIZE> _diagnostic;
+  Message_Ring<TXQ_TELEMETRY_SIZE>  _telemetry;
+
+  // the message currently being transmitted, copied out of its ring so that
+  // the rings only ever contain whole messages.
+  uint8_t _wire[TXQ_MESSAGE_MAX];
+  size_t  _wireLen;
+  size_t  _wirePos;
+
+  uint32_t _bytesDropped;
+  uint32_t _commandsDeferred;
+
+  template <size_t N>
+  bool _pushDroppable(Message_Ring<N> &ring, char const *msg, size_t len) {
+    if (tqpDropOldest == _policy) {
+      while (!ring.empty() && Message_Ring<N>::footprint(len) > ring.room()) {
+        _bytesDropped += ring.pop();
+      }
+    }
+    if (!ring.push((uint8_t const *)msg, len)) {
+      _bytesDropped += len;
+      return false;
+    }
+    return true;
+  }
+};
+
+#endif // !defined(__SERIAL_QUEUE_H__)
@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------
+//
+//  the static (heap-free) memory arena and fixed-block pool allocators
+//
+// -----------------------------------------------------------------------------
+#if !defined(__STATIC_ARENA_H__)
+#define __STATIC_ARENA_H__
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <new>
+
+// general configuration
+#define STATIC_ARENA_SIZE   4096 // bytes backing all operator new allocations
+#define STATIC_ARENA_ALIGN     8 // bytes, alignment of every arena allocation
+
+// bump allocator over a fixed buffer. memory is never reused, so there is no
+// fragmentation. once the arena has been sealed (at the end of setup()) it
+// refuses every allocation, since memory it handed out then could never be
+// reclaimed, and counts it as a violation of the steady state. refused and
+// failed allocations return nullptr, and must be served from elsewhere.
+template <size_t N>
+class Static_Arena {
+public:
+  // constexpr so that the arena is usable by operator new during static
+  // initialization, before any constructors have run.
+  constexpr Static_Arena()
+    : _buffer{},
+      _used(0),
+      _highWater(0),
+      _allocations(0),
+      _frees(0),
+      _failures(0),
+      _lateAllocations(0),
+      _sealed(false)
+    { /* constructor empty */ }
+
+  void *allocate(size_t size) {
+    size_t start = (_used + STATIC_ARENA_ALIGN - 1) & ~(size_t)(STATIC_ARENA_ALIGN - 1);
+    if (_sealed) {
+      ++_lateAllocations;
+      return nullptr;
+    }
+    if (start + size > N) {
+      ++_failures;
+      return nullptr;
+    }
+    _used = start + size;
+    if (_used > _highWater) { _highWater = _used; }
+    ++_allocations;
+    return &_buffer[start];
+  }
+
+  void deallocate(void *ptr) {
+    if (nullptr != ptr) {
+      ++_frees;
+    }
+  }
+
+  // marks the end of initialization; every allocation after this is late
+  inline void seal() { _sealed = true; }
+
+  inline bool owns(void const *ptr) const {
+    return (ptr >= (void const *)_buffer) && (ptr < (void const *)(_buffer + N));
+  }
+
+  inline size_t   capacity()        const { return N; }
+  inline size_t   used()            const { return _used; }
+  inline size_t   highWater()       const { return _highWater; }
+  inline uint32_t allocations()     const { return _allocations; }
+  inline uint32_t frees()           const { return _frees; }
+  inline uint32_t failures()        const { return _failures; }
+  inline uint32_t lateAllocations() const { return _lateAllocations; }
+  inline bool     sealed()          const { return _sealed; }
+
+private:
+  alignas(STATIC_ARENA_ALIGN) uint8_t _buffer[N];
+  size_t   _used;
+  size_t   _highWater;
+  uint32_t _allocations;
+  uint32_t _frees;
+  uint32_t _failures;
+  uint32_t _lateAllocations;
+  bool     _sealed;
+};
+
+// fixed number of equally-sized blocks in static storage, recycled through an
+// intrusive free list. one pool exists per distinct (Size, Count) pair.
+template <size_t Size, size_t Count>
+class Block_Pool {
+public:
+  static void *allocate() {
+    Block *block = nullptr;
+    if (nullptr != _free) {
+      block = _free;
+      _free = _free->next;
+    }
+    else if (_carved < Count) {
+      block = &_block[_carved++];
+    }
+    else {
+      ++_exhausted;
+      return nullptr;
+    }
+    ++_allocations;
+    if (++_inUse > _highWater) { _highWater = _inUse; }
+    return block->data;
+  }
+
+  static void deallocate(void *ptr) {
+    Block *block = (Block *)ptr;
+    block->next = _free;
+    _free = block;
+    --_inUse;
+  }
+
+  static inline bool owns(void const *ptr) {
+    return (ptr >= (void const *)_block) && (ptr < (void const *)(_block + Count));
+  }
+
+  static inline size_t   capacity()    { return Count; }
+  static inline size_t   inUse()       { return _inUse; }
+  static inline size_t   highWater()   { return _highWater; }
+  static inline uint32_t allocations() { return _allocations; }
+  static inline uint32_t exhausted()   { return _exhausted; }
+
+private:
+  union Block {
+    Block *next;
+    alignas(max_align_t) uint8_t data[Size];
+  };
+
+  static Block    _block[Count];
+  static Block   *_free;
+  static size_t   _carved; // blocks handed out at least once
+  static size_t   _inUse;
+  static size_t   _highWater;
+  static uint32_t _allocations;
+  static uint32_t _exhausted;
+};
+
+template <size_t Size, size_t Count>
+typename Block_Pool<Size, Count>::Block Block_Pool<Size, Count>::_block[Count];
+template <size_t Size, size_t Count>
+typename Block_Pool<Size, Count>::Block *Block_Pool<Size, Count>::_free = nullptr;
+template <size_t Size, size_t Count>
+size_t Block_Pool<Size, Count>::_carved = 0;
+template <size_t Size, size_t Count>
+size_t Block_Pool<Size, Count>::_inUse = 0;
+template <size_t Size, size_t Count>
+size_t Block_Pool<Size, Count>::_highWater = 0;
+template <size_t Size, size_t Count>
+uint32_t Block_Pool<Size, Count>::_allocations = 0;
+template <size_t Size, size_t Count>
+uint32_t Block_Pool<Size, Count>::_exhausted = 0;
+
+// standard (C++11) allocator for node-based containers such as std::list,
+// which only ever request a single element at a time. requests the pool
+// cannot satisfy fall through to operator new, where they are visible to the
+// arena's allocation audit.
+template <typename T, size_t Count>
+class Pool_Allocator {
+public:
+  typedef T value_type;
+  typedef Block_Pool<sizeof(T), Count> Pool;
+
+  template <typename U>
+  struct rebind { typedef Pool_Allocator<U, Count> other; };
+
+  Pool_Allocator()
+    { /* constructor empty */ }
+
+  template <typename U>
+  Pool_Allocator(const Pool_Allocator<U, Count> &)
+    { /* copy-constructor empty */ }
+
+  T *allocate(size_t n) {
+    void *ptr = nullptr;
+    if (1 == n) {
+      ptr = Pool::allocate();
+    }
+    if (nullptr == ptr) {
+      ptr = ::operator new(n * sizeof(T));
+    }
+    return (T *)ptr;
+  }
+
+  void deallocate(T *ptr, size_t /* n */) {
+    if (Pool::owns(ptr)) {
+      Pool::deallocate(ptr);
+    }
+    else {
+      ::operator delete(ptr);
+    }
+  }
+
+  template <typename U>
+  inline bool operator ==(const Pool_Allocator<U, Count> &) const { return true; }
+  template <typename U>
+  inline bool operator !=(const Pool_Allocator<U, Count> &) const { return false; }
+};
+
+#endif // !defined(__STATIC_ARENA_H__)
@@ -0,0 +1,237 @@
+// -----------------------------------------------------------------------------
+//
+//  the touchscreen calibration (fixed-point affine transform, in EEPROM)
+//
+// -----------------------------------------------------------------------------
+#if !defined(__TOUCH_CALIBRATION_H__)
+#define __TOUCH_CALIBRATION_H__
+
+#include <Arduino.h>
+#include <EEPROM.h>
+
+#include <ILI9341_t3.h>
+
+// default touch coordinate map calibration values, used for any orientation
+// that has not been calibrated interactively.
+#define XPT2046_X_LO 150
+#define XPT2046_X_HI 3800
+#define XPT2046_Y_LO 325
+#define XPT2046_Y_HI 4000
+
+// number of TFT rotation values (see Display_Orientation), each of which has
+// its own calibration since the touch driver rotates raw coordinates as well.
+#define TOUCH_CAL_NUM_ROTATION  4
+
+// coefficients are signed Q15.16 fixed-point. the linear terms are bounded to
+// magnitude < 1.0 (pixels per raw touch unit, typically ~0.07) so that the
+// transform of a 12-bit raw coordinate never overflows 32-bit integer math.
+#define TOUCH_CAL_FRAC_BITS     16
+#define TOUCH_CAL_ONE           ((int32_t)1 << TOUCH_CAL_FRAC_BITS)
+#define TOUCH_CAL_LINEAR_MAX    TOUCH_CAL_ONE
+#define TOUCH_CAL_OFFSET_MAX    ((int32_t)1 << 30)
+
+// persistent storage location and format identifier
+#define TOUCH_CAL_EEPROM_ADDR   0
+#define TOUCH_CAL_EEPROM_MAGIC  0x43415431 // "CAT1"
+
+// maps raw touch coordinates (x, y) to screen coordinates (x', y'):
+//   x' = a*x + b*y + c
+//   y' = d*x + e*y + f
+class Affine_Transform {
+public:
+  Affine_Transform()
+    : _a(TOUCH_CAL_ONE), _b(0), _c(0),
+      _d(0), _e(TOUCH_CAL_ONE), _f(0)
+    { /* constructor empty */ }
+
+  Affine_Transform(int32_t a, int32_t b, int32_t c, int32_t d, int32_t e, int32_t f)
+    : _a(a), _b(b), _c(c),
+      _d(d), _e(e), _f(f)
+    { /* constructor empty */ }
+
+  Affine_Transform(const Affine_Transform &transform)
+    : _a(transform._a), _b(transform._b), _c(transform._c),
+      _d(transform._d), _e(transform._e), _f(transform._f)
+    { /* copy-constructor empty */ }
+
+  Affine_Transform &operator =(const Affine_Transform &transform) {
+    _a = transform._a; _b = transform._b; _c = transform._c;
+    _d = transform._d; _e = transform._e; _f = transform._f;
+    return *this;
+  }
+
+  // equivalent of the original pair of map() calls, with the screen axes of
+  // the given (unrotated) dimensions reversed relative to the raw axes.
+  static Affine_Transform fromRange(int16_t width, int16_t height) {
+    int32_t xScale = ((int32_t)width  << TOUCH_CAL_FRAC_BITS) / (XPT2046_X_HI - XPT2046_X_LO);
+    int32_t yScale = ((int32_t)height << TOUCH_CAL_FRAC_BITS) / (XPT2046_Y_HI - XPT2046_Y_LO);
+    return Affine_Transform(
+      -xScale, 0, ((int32_t)width  << TOUCH_CAL_FRAC_BITS) + XPT2046_X_LO * xScale,
+      0, -yScale, ((int32_t)height << TOUCH_CAL_FRAC_BITS) + XPT2046_Y_LO * yScale
+    );
+  }
+
+  // solves for the transform that maps each of the three raw points (rx, ry)
+  // onto its corresponding screen point (sx, sy). returns false if the points
+  // are colinear or the result is out of the representable range, in which
+  // case the transform is left unmodified.
+  bool solve(
+    int32_t const rx[3], int32_t const ry[3],
+    int32_t const sx[3], int32_t const sy[3]
+  ) {
+    int64_t k = (int64_t)(rx[0] - rx[2]) * (ry[1] - ry[2])
+              - (int64_t)(rx[1] - rx[2]) * (ry[0] - ry[2]);
+    if (0 == k) {
+      return false;
+    }
+    int32_t a, b, c, d, e, f;
+    if (!_solveRow(rx, ry, sx, k, a, b, c) ||
+        !_solveRow(rx, ry, sy, k, d, e, f)) {
+      return false;
+    }
+    _a = a; _b = b; _c = c;
+    _d = d; _e = e; _f = f;
+    return true;
+  }
+
+  inline void apply(int16_t rawX, int16_t rawY, int16_t &x, int16_t &y) const {
+    // round to nearest, all integer math
+    x = (int16_t)((_a * rawX + _b * rawY + _c + (TOUCH_CAL_ONE >> 1)) >> TOUCH_CAL_FRAC_BITS);
+    y = (int16_t)((_d * rawX + _e * rawY + _f + (TOUCH_CAL_ONE >> 1)) >> TOUCH_CAL_FRAC_BITS);
+  }
+
+  inline bool valid() const {
+    return
+      _inRange(_a, TOUCH_CAL_LINEAR_MAX) && _inRange(_b, TOUCH_CAL_LINEAR_MAX) &&
+      _inRange(_d, TOUCH_CAL_LINEAR_MAX) && _inRange(_e, TOUCH_CAL_LINEAR_MAX) &&
+      _inRange(_c, TOUCH_CAL_OFFSET_MAX) && _inRange(_f, TOUCH_CAL_OFFSET_MAX);
+  }
+
+private:
+  int32_t _a, _b, _c;
+  int32_t _d, _e, _f;
+
+  static inline bool _inRange(int64_t v, int64_t max) {
+    return (v > -max) && (v < max);
+  }
+
+  // Cramer's rule on the 3x3 system for a single output axis s, with the
+  // numerators scaled to fixed-point before the (exact) integer division.
+  static bool _solveRow(
+    int32_t const rx[3], int32_t const ry[3], int32_t const s[3], int64_t k,
+    int32_t &p, int32_t &q, int32_t &r
+  ) {
+    int64_t np = (int64_t)(s[0] - s[2]) * (ry[1] - ry[2])
+               - (int64_t)(s[1] - s[2]) * (ry[0] - ry[2]);
+    int64_t nq = (int64_t)(rx[0] - rx[2]) * (s[1] - s[2])
+               - (int64_t)(s[0] - s[2]) * (rx[1] - rx[2]);
+    int64_t nr = (int64_t)ry[0] * ((int64_t)rx[2] * s[1] - (int64_t)rx[1] * s[2])
+               + (int64_t)ry[1] * ((int64_t)rx[0] * s[2] - (int64_t)rx[2] * s[0])
+               + (int64_t)ry[2] * ((int64_t)rx[1] * s[0] - (int64_t)rx[0] * s[1]);
+    int64_t vp = np * TOUCH_CAL_ONE / k;
+    int64_t vq = nq * TOUCH_CAL_ONE / k;
+    int64_t vr = nr * TOUCH_CAL_ONE / k;
+    if (!_inRange(vp, TOUCH_CAL_LINEAR_MAX) ||
+        !_inRange(vq, TOUCH_CAL_LINEAR_MAX) ||
+        !_inRange(vr, TOUCH_CAL_OFFSET_MAX)) {
+      return false;
+    }
+    p = (int32_t)vp;
+    q = (int32_t)vq;
+    r = (int32_t)vr;
+    return true;
+  }
+};
+
+class Touch_Calibration {
+public:
+  Touch_Calibration() {
+    reset();
+  }
+
+  // restores the default (uncalibrated) transform for every rotation
+  void reset() {
+    for (uint8_t i = 0; i < TOUCH_CAL_NUM_ROTATION; ++i) {
+      _reset(i);
+    }
+  }
+
+  // loads any calibration stored in EEPROM. returns false (keeping defaults)
+  // if nothing valid has been stored.
+  bool load() {
+    Record record;
+    EEPROM.get(TOUCH_CAL_EEPROM_ADDR, record);
+    if (TOUCH_CAL_EEPROM_MAGIC != record.magic ||
+        _checksum(record) != record.checksum) {
+      return false;
+    }
+    for (uint8_t i = 0; i < TOUCH_CAL_NUM_ROTATION; ++i) {
+      if (record.calibrated[i] && record.transform[i].valid()) {
+        _transform[i]  = record.transform[i];
+        _calibrated[i] = true;
+      }
+    }
+    return true;
+  }
+
+  void save() const {
+    Record record;
+    memset((void *)&record, 0, sizeof(record));
+    record.magic = TOUCH_CAL_EEPROM_MAGIC;
+    for (uint8_t i = 0; i < TOUCH_CAL_NUM_ROTATION; ++i) {
+      record.calibrated[i] = _calibrated[i] ? 1 : 0;
+      record.transform[i]  = _transform[i];
+    }
+    record.checksum = _checksum(record);
+    EEPROM.put(TOUCH_CAL_EEPROM_ADDR, record);
+  }
+
+  void set(uint8_t rotation, const Affine_Transform &transform) {
+    rotation %= TOUCH_CAL_NUM_ROTATION;
+    _transform[rotation]  = transform;
+    _calibrated[rotation] = true;
+  }
+
+  inline const Affine_Transform &transform(uint8_t rotation) const {
+    return _transform[rotation % TOUCH_CAL_NUM_ROTATION];
+  }
+
+  inline bool calibrated(uint8_t rotation) const {
+    return _calibrated[rotation % TOUCH_CAL_NUM_ROTATION];
+  }
+
+private:
+  struct Record {
+    uint32_t         magic;
+    uint8_t          calibrated[TOUCH_CAL_NUM_ROTATION];
+    Affine_Transform transform[TOUCH_CAL_NUM_ROTATION];
+    uint32_t         checksum;
+  };
+
+  Affine_Transform _transform[TOUCH_CAL_NUM_ROTATION];
+  bool             _calibrated[TOUCH_CAL_NUM_ROTATION];
+
+  void _reset(uint8_t rotation) {
+    // even rotations are portrait, odd rotations are landscape
+    if (0 == rotation % 2) {
+      _transform[rotation] = Affine_Transform::fromRange(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+    }
+    else {
+      _transform[rotation] = Affine_Transform::fromRange(ILI9341_TFTHEIGHT, ILI9341_TFTWIDTH);
+    }
+    _calibrated[rotation] = false;
+  }
+
+  static uint32_t _checksum(const Record &record) {
+    // simple Fletcher-style sum over everything preceding the checksum field
+    uint8_t const *p = (uint8_t const *)&record;
+    uint32_t s1 = 0, s2 = 0;
+    for (size_t i = 0; i < offsetof(Record, checksum); ++i) {
+      s1 = (s1 + p[i]) % 0xFFFF;
+      s2 = (s2 + s1)   % 0xFFFF;
+    }
+    return (s2 << 16) | s1;
+  }
+};
+
+#endif // !defined(__TOUCH_CALIBRATION_H__)
@@ -0,0 +1,247 @@
+package main
+
+// cathys-bench measures the end-to-end latency from a change in the IR signal
+// seen by the sensor until cathys-drive issues the corresponding drive command
+// to the robot. cathys-drive is run as built (its logs carry microsecond
+// timestamps for the benefit of this tool, which is the only accommodation it
+// makes), connected over pseudo-terminals to a stand-in for the sensor
+// firmware and a stand-in for the Create 2 OI:
+//
+//   sensor (pty) 🠊 cathys-drive 🠊 (pty) robot
+//
+// the sensor stand-in models the firmware's current pipeline (adaptive poll
+// rate, noise floors, signal detector, circular-mean bearing), so the filter
+// and link stages reflect what ships. the beacon stays hidden through warm-up;
+// the first trial makes it appear, and each one after moves it from one side
+// of the sensor array to the other. every stage along the way is timestamped:
+//
+//   filter: stimulus 🠊 first emitted bearing that cathys-drive acted on
+//   link:   that emission 🠊 cathys-drive drive decision (serial, poll, gate)
+//   serial: drive decision 🠊 drive command received by the robot
+//   total:  stimulus 🠊 drive command received by the robot
+
+import (
+	"bufio"
+	"flag"
+	"fmt"
+	"log"
+	"os"
+	"os/exec"
+	"regexp"
+	"sort"
+	"strconv"
+	"sync"
+	"text/tabwriter"
+	"time"
+)
+
+type Decision struct {
+	Time  time.Time
+	Angle int16
+}
+
+// cathys-drive's drive decision log, e.g.:
+//
+//	[ ] 15:04:05.000000 drive: (-90°,50.0%): 1@100 [ ← ]
+var decisionPattern = regexp.MustCompile(`^\[ \] (\d{2}:\d{2}:\d{2}\.\d{6}) drive: \((-?\d+)°`)
+
+// the log only carries the time of day, so the decision is placed on the day
+// that puts it nearest to when the line was read, which is correct across
+// midnight as long as cathys-drive's output is read within 12 hours.
+func parseDecision(line string, read time.Time) (Decision, bool) {
+	m := decisionPattern.FindStringSubmatch(line)
+	if nil == m {
+		return Decision{}, false
+	}
+	tod, err := time.ParseInLocation("15:04:05.000000", m[1], time.Local)
+	if nil != err {
+		return Decision{}, false
+	}
+	t := time.Date(read.Year(), read.Month(), read.Day(),
+		tod.Hour(), tod.Minute(), tod.Second(), tod.Nanosecond(), time.Local)
+	if d := t.Sub(read); d > 12*time.Hour {
+		t = t.AddDate(0, 0, -1) // logged before midnight, read after
+	} else if d < -12*time.Hour {
+		t = t.AddDate(0, 0, 1) // logged after midnight, read before (clock skew)
+	}
+	a, err := strconv.Atoi(m[2])
+	if nil != err {
+		return Decision{}, false
+	}
+	return Decision{Time: t, Angle: int16(a)}, true
+}
+
+type Stage struct {
+	name   string
+	sample []time.Duration
+}
+
+func (s *Stage) Add(d time.Duration) { s.sample = append(s.sample, d) }
+
+func (s *Stage) Percentile(p float64) time.Duration {
+	if 0 == len(s.sample) {
+		return 0
+	}
+	sorted := append([]time.Duration{}, s.sample...)
+	sort.Slice(sorted, func(i, j int) bool { return sorted[i] < sorted[j] })
+	// nearest-rank
+	k := int(p/100.0*float64(len(sorted))+0.5) - 1
+	if k < 0 {
+		k = 0
+	}
+	if k >= len(sorted) {
+		k = len(sorted) - 1
+	}
+	return sorted[k]
+}
+
+func report(stages []*Stage, timeouts int) {
+	w := tabwriter.NewWriter(os.Stdout, 0, 4, 2, ' ', tabwriter.AlignRight)
+	fmt.Fprintln(w, "stage\tn\tp50\tp90\tp99\tmax\t")
+	for _, s := range stages {
+		fmt.Fprintf(w, "%s\t%d\t%v\t%v\t%v\t%v\t\n", s.name, len(s.sample),
+			s.Percentile(50).Round(time.Microsecond), s.Percentile(90).Round(time.Microsecond),
+			s.Percentile(99).Round(time.Microsecond), s.Percentile(100).Round(time.Microsecond))
+	}
+	w.Flush()
+	if timeouts > 0 {
+		fmt.Printf("%d trial(s) timed out without a drive command\n", timeouts)
+	}
+}
+
+func main() {
+
+	drivePath := flag.String("drive", "./cathys-drive", "path to the cathys-drive `executable`")
+	trials := flag.Int("trials", 20, "number of stimulus `trials`")
+	settle := flag.Duration("settle", 5*time.Second, "time held at each position, must exceed the sample window plus drive gate")
+	warmup := flag.Duration("warmup", 10*time.Second, "time allowed for cathys-drive and the sensor window to start up")
+	verbose := flag.Bool("v", false, "echo cathys-drive output")
+	flag.Parse()
+
+	infoLog := log.New(os.Stderr, "[ ] ", log.Ltime)
+
+	ssuPty, err := MakePty()
+	if nil != err {
+		log.Fatal(err)
+	}
+	defer ssuPty.Close()
+	botPty, err := MakePty()
+	if nil != err {
+		log.Fatal(err)
+	}
+	defer botPty.Close()
+
+	left, right := 0, numIRDiode-1
+	sensor := MakeSensor(ssuPty)
+	robot := MakeRobot(botPty)
+	go sensor.Serve()
+	go robot.Serve()
+
+	cmd := exec.Command(*drivePath, botPty.Path(), ssuPty.Path())
+	stdout, err := cmd.StdoutPipe()
+	if nil != err {
+		log.Fatal(err)
+	}
+	if *verbose {
+		cmd.Stderr = os.Stderr
+	}
+	if err := cmd.Start(); nil != err {
+		log.Fatalf("failed to start cathys-drive: %s: %s", *drivePath, err)
+	}
+	defer func() {
+		cmd.Process.Signal(os.Interrupt)
+		cmd.Wait()
+	}()
+
+	decision := make(chan Decision, 64)
+	go func() {
+		scan := bufio.NewScanner(stdout)
+		for scan.Scan() {
+			if *verbose {
+				fmt.Fprintln(os.Stderr, scan.Text())
+			}
+			if d, ok := parseDecision(scan.Text(), time.Now()); ok {
+				select {
+				case decision <- d:
+				default:
+				}
+			}
+		}
+	}()
+
+	infoLog.Printf("sensor on %s, robot on %s, warming up for %v", ssuPty.Path(), botPty.Path(), *warmup)
+	<-time.After(*warmup)
+
+	var (
+		filter   = &Stage{name: "filter"}
+		link     = &Stage{name: "link"}
+		serial   = &Stage{name: "serial"}
+		total    = &Stage{name: "total"}
+		timeouts = 0
+		once     sync.Once
+	)
+
+	pos := right
+	for t := 0; t < *trials; t++ {
+		// discard anything that happened before this stimulus
+		for drained := false; !drained; {
+			select {
+			case <-decision:
+			case <-robot.Drive():
+			default:
+				drained = true
+			}
+		}
+
+		stim := sensor.Stimulate(pos)
+		end := stim.Add(*settle)
+		deadline := time.After(time.Until(end))
+
+		var (
+			dec    *Decision
+			wheels *DriveEvent
+		)
+	wait:
+		for nil == dec || nil == wheels {
+			select {
+			case d := <-decision:
+				if nil == dec && d.Time.After(stim) {
+					dec = &d
+				}
+			case e := <-robot.Drive():
+				if nil == wheels && e.Time.After(stim) {
+					wheels = &e
+				}
+			case <-deadline:
+				break wait
+			}
+		}
+
+		if nil == dec || nil == wheels {
+			timeouts++
+			infoLog.Printf("trial %d: timed out", t+1)
+		} else {
+			if emit, ok := sensor.FirstEmitted(dec.Angle); ok {
+				filter.Add(emit.Sub(stim))
+				link.Add(dec.Time.Sub(emit))
+			} else {
+				once.Do(func() {
+					infoLog.Printf("could not match a drive decision to an emitted bearing")
+				})
+			}
+			serial.Add(wheels.Time.Sub(dec.Time))
+			total.Add(wheels.Time.Sub(stim))
+			infoLog.Printf("trial %d: %v", t+1, wheels.Time.Sub(stim).Round(time.Microsecond))
+		}
+
+		// hold this position until the full settle time has passed
+		time.Sleep(time.Until(end))
+		if pos == right {
+			pos = left
+		} else {
+			pos = right
+		}
+	}
+
+	report([]*Stage{filter, link, serial, total}, timeouts)
+}
@@ -0,0 +1,240 @@
+package main
+
+import (
+	"sync"
+	"time"
+)
+
+// stand-in for the iRobot Create 2 Open Interface on the far end of a pty. it
+// parses the command stream sent by cathys-drive (via oibot), tracks the OI
+// mode, answers sensor queries, and timestamps every drive command received.
+// see the iRobot Create 2 Open Interface (OI) Specification for the opcodes,
+// argument sizes, and sensor packet layouts used here.
+
+const (
+	opStart            = 128
+	opBaud             = 129
+	opControl          = 130
+	opSafe             = 131
+	opFull             = 132
+	opPower            = 133
+	opDrive            = 137
+	opSensors          = 142
+	opStream           = 148
+	opQueryList        = 149
+	opPauseStream      = 150
+	opStop             = 173
+	opReset            = 7
+	streamHeader       = 19
+	streamPeriod       = 15 * time.Millisecond
+	modeOff            = 0
+	modePassive        = 1
+	modeSafe           = 2
+	modeFull           = 3
+	packetOIMode       = 35
+	packetCharge       = 25
+	packetCapacity     = 26
+	batteryChargemAh   = 2000
+	batteryCapacitymAh = 2600
+)
+
+// fixed argument sizes of every opcode that does not carry a variable-length
+// argument list (sensors, stream and query list are handled separately).
+var opArgSize = map[byte]int{
+	opReset: 0, opStart: 0, opBaud: 1, opControl: 0, opSafe: 0, opFull: 0,
+	opPower: 0, 134: 0, 135: 0, 136: 0, opDrive: 4, 138: 1, 139: 3, 141: 1,
+	143: 0, 144: 3, 145: 4, 146: 4, 147: 1, 151: 1, 162: 2, 163: 4, 164: 4,
+	165: 1, 167: 15, 168: 3, opStop: 0,
+}
+
+// constituent packets of each sensor group packet
+var sensorGroup = map[byte][2]byte{
+	0: {7, 26}, 1: {7, 16}, 2: {17, 20}, 3: {21, 26}, 4: {27, 34}, 5: {35, 42},
+	6: {7, 42}, 100: {7, 58}, 101: {43, 58}, 106: {46, 51}, 107: {54, 58},
+}
+
+// sensor packets two bytes wide, all others in [7, 58] are a single byte
+var sensorWord = map[byte]bool{
+	19: true, 20: true, 22: true, 23: true, 25: true, 26: true, 27: true,
+	28: true, 29: true, 30: true, 31: true, 33: true, 39: true, 40: true,
+	41: true, 42: true, 43: true, 44: true, 46: true, 47: true, 48: true,
+	49: true, 50: true, 51: true, 54: true, 55: true, 56: true, 57: true,
+}
+
+type DriveEvent struct {
+	Time             time.Time
+	VelocityMMPerSec int16
+	RadiusMM         int16
+}
+
+type Robot struct {
+	*sync.Mutex
+	pty       *Pty
+	mode      byte
+	stream    []byte // packet IDs being streamed, if any
+	streaming bool
+	drive     chan DriveEvent
+}
+
+func MakeRobot(pty *Pty) *Robot {
+	return &Robot{Mutex: &sync.Mutex{}, pty: pty, mode: modeOff, drive: make(chan DriveEvent, 64)}
+}
+
+func (r *Robot) Drive() <-chan DriveEvent { return r.drive }
+
+func (r *Robot) appendPacket(buf []byte, id byte) []byte {
+	if g, ok := sensorGroup[id]; ok {
+		for p := g[0]; p <= g[1]; p++ {
+			buf = r.appendPacket(buf, p)
+		}
+		return buf
+	}
+	var v uint16
+	switch id {
+	case packetOIMode:
+		v = uint16(r.mode)
+	case packetCharge:
+		v = batteryChargemAh
+	case packetCapacity:
+		v = batteryCapacitymAh
+	}
+	if sensorWord[id] {
+		return append(buf, byte(v>>8), byte(v))
+	}
+	return append(buf, byte(v))
+}
+
+func (r *Robot) respond(ids []byte) {
+	r.Mutex.Lock()
+	var buf []byte
+	for _, id := range ids {
+		buf = r.appendPacket(buf, id)
+	}
+	r.Mutex.Unlock()
+	r.pty.Write(buf)
+}
+
+func (r *Robot) streamFrame() []byte {
+	r.Mutex.Lock()
+	defer r.Mutex.Unlock()
+	if !r.streaming || 0 == len(r.stream) {
+		return nil
+	}
+	body := []byte{}
+	for _, id := range r.stream {
+		body = append(body, id)
+		body = r.appendPacket(body, id)
+	}
+	frame := append([]byte{streamHeader, byte(len(body))}, body...)
+	var sum byte
+	for _, b := range frame {
+		sum += b
+	}
+	return append(frame, -sum) // all bytes, checksum included, sum to zero
+}
+
+// Serve runs until the pty is closed.
+func (r *Robot) Serve() {
+	go func() {
+		for range time.Tick(streamPeriod) {
+			if frame := r.streamFrame(); nil != frame {
+				r.pty.Write(frame)
+			}
+		}
+	}()
+
+	in := make(chan byte, 256)
+	go func() {
+		defer close(in)
+		buf := make([]byte, 256)
+		for {
+			n, err := r.pty.Read(buf)
+			if nil != err {
+				return
+			}
+			for _, b := range buf[:n] {
+				in <- b
+			}
+		}
+	}()
+
+	next := func(n int) ([]byte, bool) {
+		arg := make([]byte, n)
+		for i := range arg {
+			b, ok := <-in
+			if !ok {
+				return nil, false
+			}
+			arg[i] = b
+		}
+		return arg, true
+	}
+
+	for op := range in {
+		now := time.Now()
+		switch op {
+		case opSensors:
+			if id, ok := next(1); ok {
+				r.respond(id)
+			}
+		case opQueryList, opStream:
+			n, ok := next(1)
+			if !ok {
+				return
+			}
+			ids, ok := next(int(n[0]))
+			if !ok {
+				return
+			}
+			if opQueryList == op {
+				r.respond(ids)
+			} else {
+				r.Mutex.Lock()
+				r.stream, r.streaming = ids, true
+				r.Mutex.Unlock()
+			}
+		case opPauseStream:
+			if arg, ok := next(1); ok {
+				r.Mutex.Lock()
+				r.streaming = 0 != arg[0]
+				r.Mutex.Unlock()
+			}
+		case 140: // song: number, length, then (note, duration) pairs
+			if hdr, ok := next(2); ok {
+				next(2 * int(hdr[1]))
+			}
+		default:
+			size, known := opArgSize[op]
+			if !known {
+				continue // out of sync, or unsupported. skip byte-wise.
+			}
+			arg, ok := next(size)
+			if !ok {
+				return
+			}
+			r.Mutex.Lock()
+			switch op {
+			case opStart, opControl:
+				r.mode = modePassive
+			case opSafe:
+				r.mode = modeSafe
+			case opFull:
+				r.mode = modeFull
+			case opPower, opStop, opReset:
+				r.mode = modeOff
+			}
+			r.Mutex.Unlock()
+			if opDrive == op {
+				ev := DriveEvent{
+					Time:             now,
+					VelocityMMPerSec: int16(uint16(arg[0])<<8 | uint16(arg[1])),
+					RadiusMM:         int16(uint16(arg[2])<<8 | uint16(arg[3])),
+				}
+				select {
+				case r.drive <- ev:
+				default: // nobody listening, drop it
+				}
+			}
+		}
+	}
+}
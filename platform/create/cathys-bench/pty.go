@@ -0,0 +1,82 @@
+package main
+
+import (
+	"fmt"
+	"os"
+	"syscall"
+	"unsafe"
+)
+
+// Pty is a pseudo-terminal pair. the master side is used by the benchmark to
+// stand in for a device, the slave side is handed to cathys-drive as if it
+// were that device's serial port.
+type Pty struct {
+	master *os.File
+	slave  *os.File // held open so the link survives cathys-drive restarts
+	path   string
+}
+
+func ioctl(fd uintptr, req uintptr, arg uintptr) error {
+	if _, _, errno := syscall.Syscall(syscall.SYS_IOCTL, fd, req, arg); 0 != errno {
+		return errno
+	}
+	return nil
+}
+
+func MakePty() (*Pty, error) {
+	master, err := os.OpenFile("/dev/ptmx", os.O_RDWR|syscall.O_NOCTTY, 0)
+	if nil != err {
+		return nil, fmt.Errorf("failed to open pty master: %s", err)
+	}
+	var (
+		num    uint32
+		unlock int32
+	)
+	if err := ioctl(master.Fd(), syscall.TIOCGPTN, uintptr(unsafe.Pointer(&num))); nil != err {
+		master.Close()
+		return nil, fmt.Errorf("failed to get pty number: %s", err)
+	}
+	if err := ioctl(master.Fd(), syscall.TIOCSPTLCK, uintptr(unsafe.Pointer(&unlock))); nil != err {
+		master.Close()
+		return nil, fmt.Errorf("failed to unlock pty: %s", err)
+	}
+	path := fmt.Sprintf("/dev/pts/%d", num)
+	slave, err := os.OpenFile(path, os.O_RDWR|syscall.O_NOCTTY, 0)
+	if nil != err {
+		master.Close()
+		return nil, fmt.Errorf("failed to open pty slave: %s: %s", path, err)
+	}
+	if err := makeRaw(slave); nil != err {
+		slave.Close()
+		master.Close()
+		return nil, fmt.Errorf("failed to set pty raw mode: %s: %s", path, err)
+	}
+	return &Pty{master: master, slave: slave, path: path}, nil
+}
+
+// makeRaw disables all line discipline processing (echo, canonical mode, CR/LF
+// translation) so that bytes pass through the pty exactly as on a serial port.
+func makeRaw(f *os.File) error {
+	var t syscall.Termios
+	if err := ioctl(f.Fd(), syscall.TCGETS, uintptr(unsafe.Pointer(&t))); nil != err {
+		return err
+	}
+	t.Iflag &^= syscall.IGNBRK | syscall.BRKINT | syscall.PARMRK | syscall.ISTRIP |
+		syscall.INLCR | syscall.IGNCR | syscall.ICRNL | syscall.IXON
+	t.Oflag &^= syscall.OPOST
+	t.Lflag &^= syscall.ECHO | syscall.ECHONL | syscall.ICANON | syscall.ISIG | syscall.IEXTEN
+	t.Cflag &^= syscall.CSIZE | syscall.PARENB
+	t.Cflag |= syscall.CS8
+	t.Cc[syscall.VMIN] = 1
+	t.Cc[syscall.VTIME] = 0
+	return ioctl(f.Fd(), syscall.TCSETS, uintptr(unsafe.Pointer(&t)))
+}
+
+func (p *Pty) Read(buf []byte) (int, error)  { return p.master.Read(buf) }
+func (p *Pty) Write(buf []byte) (int, error) { return p.master.Write(buf) }
+func (p *Pty) Path() string                  { return p.path }
+
+func (p *Pty) Close() {
+	p.slave.Close()
+	p.master.Close()
+}
@@ -0,0 +1,336 @@
+package main
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"sync"
+	"time"
+)
+
+// stand-in for the cathys-sensor firmware on the far end of a pty. the ADC is
+// replaced by a synthetic scene (a beacon pointed at one of the diodes, under
+// ambient light that differs slightly from diode to diode, plus gaussian
+// noise), but every stage after it follows the firmware:
+//
+//   Sample_Rate_Controller  adaptive poll period, 250 Hz down to 50 Hz
+//   Noise_Floor             per-diode ambient level and spread
+//   Signal_Detector         smoothed SNR with acquire/release hysteresis
+//   Cathys_Sensor::loop()   time-weighted circular mean of the brightest
+//                           diode's bearing over the sample window
+//
+// one JSON message is emitted per poll, carrying the rounded bearing and the
+// intensity only while a signal is detected, as the sketch's loop() does.
+
+const (
+	numIRDiode   = 6                       // IR_DIODES_PER_ARRAY, front array only
+	angleMinDeg  = -90                     // ANGLE_MIN_DEG
+	angleMaxDeg  = 90                      // ANGLE_MAX_DEG
+	sampleWindow = 2500 * time.Millisecond // IR_SAMPLE_WINDOW_MS
+	sampleMax    = 8191                    // IR_SAMPLE_MAX, with 13-bit samples
+	sampleScale  = 8                       // IR_SAMPLE_SCALE
+	bearingOne   = 16384                   // IR_BEARING_ONE
+
+	pollMinUS         = 4000  // IR_POLL_MIN_US
+	pollMaxUS         = 20000 // IR_POLL_MAX_US
+	pollStartUS       = 10000 // IR_POLL_START_US
+	rateBackoffUS     = 1000  // IR_RATE_BACKOFF_US
+	rateBearingWeight = 1.78  // IR_RATE_BEARING_WEIGHT
+	rateSmoothing     = 0.25  // IR_RATE_SMOOTHING
+	rateFastActivity  = 24.0  // IR_RATE_FAST_ACTIVITY
+	rateSlowActivity  = 6.0   // IR_RATE_SLOW_ACTIVITY
+
+	noiseFloorRiseUS  = 500e3             // NOISE_FLOOR_RISE_MS
+	noiseFloorFallUS  = 5000e3            // NOISE_FLOOR_FALL_MS
+	noiseFloorHoldUS  = 300000e3          // NOISE_FLOOR_HOLD_MS
+	noiseSpreadUS     = 2000e3            // NOISE_SPREAD_MS
+	noiseSpreadMin    = 2.0               // NOISE_SPREAD_MIN
+	noiseSpreadStart  = 8.0 * sampleScale // NOISE_SPREAD_START
+	noiseOutlier      = 3.0               // NOISE_OUTLIER
+	noiseAmbientShift = 0.75              // NOISE_AMBIENT_SHIFT
+	snrAcquire        = 6.0               // IR_SNR_ACQUIRE
+	snrRelease        = 3.0               // IR_SNR_RELEASE
+	snrSmoothingUS    = 100e3             // IR_SNR_SMOOTHING_MS
+
+	sceneAmbient     = 6000.0 // raw counts, smaller is brighter
+	sceneAmbientSpan = 200.0  // spread of the ambient level between diodes
+	sceneNoise       = 12.0   // standard deviation of every reading
+	sceneDepth       = 1500.0 // beacon brightness, in counts below ambient
+	sceneLobeDeg     = 45.0   // half-width of each diode's response
+)
+
+type Output struct {
+	Time  time.Time
+	Angle int16
+}
+
+type Sensor struct {
+	*sync.Mutex
+	pty     *Pty
+	beacon  float64  // bearing of the beacon, NaN while hidden
+	history []Output // every message emitted since the last stimulus
+}
+
+// MakeSensor returns a sensor whose beacon is hidden until the first stimulus,
+// so that its noise floors learn the ambient level while warming up.
+func MakeSensor(pty *Pty) *Sensor {
+	return &Sensor{Mutex: &sync.Mutex{}, pty: pty, beacon: math.NaN()}
+}
+
+// diodeBearing returns the bearing of the given diode, the same as the
+// Cathys_Sensor constructor.
+func diodeBearing(led int) float64 {
+	return angleMinDeg + float64(angleMaxDeg-angleMinDeg)*float64(led)/(numIRDiode-1)
+}
+
+// Stimulate points the beacon at the given diode, returning the time at which
+// the next sample will see the change.
+func (s *Sensor) Stimulate(led int) time.Time {
+	s.Mutex.Lock()
+	defer s.Mutex.Unlock()
+	s.beacon = diodeBearing(led)
+	s.history = s.history[:0]
+	return time.Now()
+}
+
+// FirstEmitted returns the time at which a message carrying the given angle
+// was first emitted since the last stimulus.
+func (s *Sensor) FirstEmitted(angle int16) (time.Time, bool) {
+	s.Mutex.Lock()
+	defer s.Mutex.Unlock()
+	for _, o := range s.history {
+		if o.Angle == angle {
+			return o.Time, true
+		}
+	}
+	return time.Time{}, false
+}
+
+func ewmaWeight(dtUS, tauUS float64) float64 {
+	return math.Min(dtUS/tauUS, 1)
+}
+
+// see Noise_Floor
+type noiseFloor struct {
+	level, spread float64
+	primed        bool
+}
+
+func (f *noiseFloor) update(value int16, dtUS float64, ambientShift bool) {
+	if !f.primed {
+		f.level, f.spread, f.primed = float64(value), noiseSpreadStart, true
+		return
+	}
+	deviation := float64(value) - f.level
+	outlier := math.Abs(deviation) > noiseOutlier*f.spread
+	tau := noiseFloorFallUS
+	if deviation > 0 || ambientShift {
+		tau = noiseFloorRiseUS
+	} else if outlier {
+		tau = noiseFloorHoldUS
+	}
+	f.level += ewmaWeight(dtUS, tau) * deviation
+	if !outlier {
+		f.spread += ewmaWeight(dtUS, noiseSpreadUS) * (math.Abs(deviation) - f.spread)
+		f.spread = math.Max(f.spread, noiseSpreadMin)
+	}
+}
+
+func (f *noiseFloor) snr(value int16) float64 {
+	if !f.primed {
+		return 0
+	}
+	return (f.level - float64(value)) / f.spread
+}
+
+// see Signal_Detector
+type detector struct {
+	snr    float64
+	signal bool
+}
+
+func (d *detector) update(snr, dtUS float64) bool {
+	d.snr += ewmaWeight(dtUS, snrSmoothingUS) * (snr - d.snr)
+	if d.signal {
+		d.signal = d.snr >= snrRelease
+	} else {
+		d.signal = d.snr >= snrAcquire
+	}
+	return d.signal
+}
+
+// see Sample_Rate_Controller
+type rateController struct {
+	periodUS    uint32
+	activity    float64
+	primed      bool
+	lastBearing int
+	lastValue   int16
+}
+
+func (r *rateController) update(bearing int, value int16) uint32 {
+	if r.primed {
+		turn := bearing - r.lastBearing
+		if turn < 0 {
+			turn = -turn
+		}
+		if turn > 180 {
+			turn = 360 - turn
+		}
+		change := math.Abs(float64(value-r.lastValue))/sampleScale + float64(turn)*rateBearingWeight
+		r.activity += rateSmoothing * (change - r.activity)
+		if r.activity > rateFastActivity {
+			r.periodUS /= 2
+			if r.periodUS < pollMinUS {
+				r.periodUS = pollMinUS
+			}
+		} else if r.activity < rateSlowActivity {
+			r.periodUS += rateBackoffUS
+			if r.periodUS > pollMaxUS {
+				r.periodUS = pollMaxUS
+			}
+		}
+	}
+	r.lastBearing, r.lastValue, r.primed = bearing, value, true
+	return r.periodUS
+}
+
+// one entry of the rolling window: the brightest diode of a frame
+type sample struct {
+	timeUS uint32
+	led    int
+	value  int16
+}
+
+// frame reads every diode from the synthetic scene
+func (s *Sensor) frame(rng *rand.Rand, ambient []float64, value []int16) {
+	s.Mutex.Lock()
+	beacon := s.beacon
+	s.Mutex.Unlock()
+	for i := range value {
+		v := ambient[i] + rng.NormFloat64()*sceneNoise
+		if off := math.Abs(diodeBearing(i) - beacon); off < 2*sceneLobeDeg { // false while hidden
+			v -= sceneDepth * 0.5 * (1 + math.Cos(math.Pi*off/(2*sceneLobeDeg)))
+		}
+		value[i] = int16(math.Max(0, math.Min(sampleMax, math.Round(v))))
+	}
+}
+
+// Serve runs until the pty is closed.
+func (s *Sensor) Serve() {
+	// discard the status downlink, only so that the pty buffer never fills
+	go func() {
+		buf := make([]byte, 256)
+		for {
+			if _, err := s.pty.Read(buf); nil != err {
+				return
+			}
+		}
+	}()
+
+	var (
+		rng       = rand.New(rand.NewSource(1))
+		ambient   = make([]float64, numIRDiode)
+		value     = make([]int16, numIRDiode)
+		bearingX  = make([]int64, numIRDiode) // Q14, as in the firmware
+		bearingY  = make([]int64, numIRDiode)
+		floor     = make([]noiseFloor, numIRDiode)
+		detect    detector
+		rate      = rateController{periodUS: pollStartUS}
+		window    []sample // oldest first
+		sumWeight int64
+		sumX      int64
+		sumY      int64
+		sumValue  int64
+		lastUS    uint32
+		ready     bool
+		average   float64 // bearing, degrees
+		avgValue  float64
+		start     = time.Now()
+		next      = start
+	)
+	for i := range ambient {
+		ambient[i] = sceneAmbient + sceneAmbientSpan*(2*rng.Float64()-1)
+		b := diodeBearing(i) * math.Pi / 180
+		bearingX[i] = int64(math.Round(math.Cos(b) * bearingOne))
+		bearingY[i] = int64(math.Round(math.Sin(b) * bearingOne))
+	}
+	for {
+		// each poll is scheduled from the start of the previous one
+		time.Sleep(time.Until(next))
+		now := time.Now()
+		us := uint32(now.Sub(start) / time.Microsecond)
+
+		s.frame(rng, ambient, value)
+		brightest := 0
+		for i, v := range value {
+			if v < value[brightest] {
+				brightest = i
+			}
+		}
+		period := rate.update(int(math.Round(diodeBearing(brightest))), value[brightest])
+		next = now.Add(time.Duration(period) * time.Microsecond)
+
+		dt := float64(us - lastUS)
+		lastUS = us
+		snr, brighter := 0.0, 0
+		for i, v := range value {
+			r := floor[i].snr(v)
+			snr = math.Max(snr, r)
+			if r > noiseOutlier {
+				brighter++
+			}
+		}
+		shift := float64(brighter) > noiseAmbientShift*numIRDiode
+		for i, v := range value {
+			floor[i].update(v, dt, shift)
+		}
+		detect.update(snr, dt)
+
+		// the previous sample is weighted by how long it held
+		if n := len(window); n > 0 {
+			prev := window[n-1]
+			w := int64(us - prev.timeUS)
+			sumWeight += w
+			sumX += bearingX[prev.led] * w
+			sumY += bearingY[prev.led] * w
+			sumValue += int64(prev.value) * w
+		}
+		window = append(window, sample{timeUS: us, led: brightest, value: value[brightest]})
+		for len(window) > 2 && us-window[1].timeUS >= uint32(sampleWindow/time.Microsecond) {
+			w := int64(window[1].timeUS - window[0].timeUS)
+			sumWeight -= w
+			sumX -= bearingX[window[0].led] * w
+			sumY -= bearingY[window[0].led] * w
+			sumValue -= int64(window[0].value) * w
+			window = window[1:]
+		}
+		if !ready && now.Sub(start) >= sampleWindow {
+			ready = true
+		}
+		if ready {
+			if sumWeight > 0 {
+				average = math.Atan2(float64(sumY), float64(sumX)) * 180 / math.Pi
+				avgValue = float64(sumValue) / float64(sumWeight)
+			} else {
+				average = diodeBearing(brightest)
+				avgValue = float64(value[brightest])
+			}
+		}
+
+		msg := fmt.Sprintf("{\"time-us\":%d,\"ir-angle\":-1,\"ir-intensity\":-1}\n", us)
+		out := Output{Time: time.Now(), Angle: -1}
+		if ready && detect.signal {
+			// Cathys_Sensor::angle() and intensity(), front array only
+			out.Angle = int16(math.Max(angleMinDeg, math.Min(angleMaxDeg, math.Round(average))))
+			intensity := math.Max(0, sampleMax-avgValue) * 100 / sampleMax
+			msg = fmt.Sprintf("{\"time-us\":%d,\"ir-angle\":%d,\"ir-intensity\":%.2f}\n", us, out.Angle, intensity)
+		}
+		if _, err := s.pty.Write([]byte(msg)); nil != err {
+			return
+		}
+		s.Mutex.Lock()
+		s.history = append(s.history, out)
+		s.Mutex.Unlock()
+	}
+}
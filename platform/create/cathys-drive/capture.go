@@ -0,0 +1,179 @@
+package main
+
+import (
+	"encoding/base64"
+	"encoding/binary"
+	"encoding/csv"
+	"fmt"
+	"os"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+// the diagnostic packet format is defined in cathys-sensor's diag-stream.h.
+// packets arrive as individual lines prefixed with diagLinePrefix, batching a
+// number of raw IR diode frames: the first frame absolute, followed by the
+// delta of each frame from the one before it. the number of diodes per frame
+// depends on how many diode arrays the sensor has, and is given in the header.
+const (
+	diagLinePrefix   = "@"
+	diagHeaderSize   = 3
+	maxDiagBatch     = 8 // DIAG_BATCH_MAX
+	defaultDiagBatch = 4
+)
+
+func diagFrameSize(numDiode int) int {
+	return 4 + 2*numDiode
+}
+
+type DiagnosticFrame struct {
+	TimeUS uint32
+	Value  []int16
+}
+
+type DiagnosticPacket struct {
+	Sequence uint8
+	Frame    []DiagnosticFrame
+}
+
+func zigzagDecode(v uint64) int64 {
+	return int64(v>>1) ^ -int64(v&1)
+}
+
+func DecodeDiagnostic(line string) (*DiagnosticPacket, error) {
+	if !strings.HasPrefix(line, diagLinePrefix) {
+		return nil, fmt.Errorf("not a diagnostic packet")
+	}
+	buf, err := base64.StdEncoding.DecodeString(strings.TrimPrefix(line, diagLinePrefix))
+	if nil != err {
+		return nil, fmt.Errorf("invalid diagnostic packet encoding: %s", err)
+	}
+	if len(buf) < diagHeaderSize {
+		return nil, fmt.Errorf("short diagnostic packet: %d bytes", len(buf))
+	}
+	numDiode := int(buf[2])
+	if len(buf) < diagHeaderSize+diagFrameSize(numDiode) {
+		return nil, fmt.Errorf("short diagnostic packet: %d bytes", len(buf))
+	}
+	pkt := &DiagnosticPacket{Sequence: buf[0], Frame: make([]DiagnosticFrame, buf[1])}
+	if 0 == len(pkt.Frame) {
+		return pkt, nil
+	}
+	for f := range pkt.Frame {
+		pkt.Frame[f].Value = make([]int16, numDiode)
+	}
+	pos := diagHeaderSize
+	first := &pkt.Frame[0]
+	first.TimeUS = binary.LittleEndian.Uint32(buf[pos:])
+	pos += 4
+	for i := range first.Value {
+		first.Value[i] = int16(binary.LittleEndian.Uint16(buf[pos:]))
+		pos += 2
+	}
+	next := func() (uint64, error) {
+		v, n := binary.Uvarint(buf[pos:])
+		if n <= 0 {
+			return 0, fmt.Errorf("truncated diagnostic packet")
+		}
+		pos += n
+		return v, nil
+	}
+	for f := 1; f < len(pkt.Frame); f++ {
+		prev, curr := &pkt.Frame[f-1], &pkt.Frame[f]
+		dt, err := next()
+		if nil != err {
+			return nil, err
+		}
+		curr.TimeUS = prev.TimeUS + uint32(dt)
+		for i := range curr.Value {
+			dv, err := next()
+			if nil != err {
+				return nil, err
+			}
+			curr.Value[i] = prev.Value[i] + int16(zigzagDecode(dv))
+		}
+	}
+	return pkt, nil
+}
+
+// Capture writes every decoded diagnostic frame to a CSV file on disk, one row
+// per frame, and keeps count of packets lost on the link (by sequence number).
+// the CSV header is written with the first packet, once the number of diodes
+// is known.
+type Capture struct {
+	*sync.Mutex
+	file     *os.File
+	csv      *csv.Writer
+	numDiode int // columns in the header, 0 until it has been written
+	sequence int
+	packets  uint64
+	lost     uint64
+}
+
+func MakeCapture(path string) (*Capture, error) {
+	file, err := os.Create(path)
+	if nil != err {
+		return nil, fmt.Errorf("failed to create capture file: %s: %s", path, err)
+	}
+	return &Capture{Mutex: &sync.Mutex{}, file: file, csv: csv.NewWriter(file), sequence: -1}, nil
+}
+
+func (c *Capture) writeHeader(numDiode int) error {
+	header := []string{"time-us", "sequence"}
+	for i := 1; i <= numDiode; i++ {
+		header = append(header, fmt.Sprintf("ir-diode-%d", i))
+	}
+	if err := c.csv.Write(header); nil != err {
+		return fmt.Errorf("failed to write capture file: %s: %s", c.file.Name(), err)
+	}
+	c.numDiode = numDiode
+	return nil
+}
+
+func (c *Capture) Write(pkt *DiagnosticPacket) error {
+	c.Mutex.Lock()
+	defer c.Mutex.Unlock()
+	if 0 == len(pkt.Frame) {
+		return nil
+	}
+	numDiode := len(pkt.Frame[0].Value)
+	if 0 == c.numDiode {
+		if err := c.writeHeader(numDiode); nil != err {
+			return err
+		}
+	} else if numDiode != c.numDiode {
+		return fmt.Errorf("diagnostic packet has %d diodes, capture has %d", numDiode, c.numDiode)
+	}
+	if c.sequence >= 0 {
+		c.lost += uint64(uint8(int(pkt.Sequence) - c.sequence - 1))
+	}
+	c.sequence = int(pkt.Sequence)
+	c.packets++
+	row := make([]string, 2+numDiode)
+	for _, f := range pkt.Frame {
+		row[0] = strconv.FormatUint(uint64(f.TimeUS), 10)
+		row[1] = strconv.Itoa(int(pkt.Sequence))
+		for i, v := range f.Value {
+			row[2+i] = strconv.Itoa(int(v))
+		}
+		if err := c.csv.Write(row); nil != err {
+			return err
+		}
+	}
+	c.csv.Flush()
+	return c.csv.Error()
+}
+
+func (c *Capture) Stats() (packets uint64, lost uint64) {
+	c.Mutex.Lock()
+	defer c.Mutex.Unlock()
+	return c.packets, c.lost
+}
+
+func (c *Capture) Close() error {
+	c.Mutex.Lock()
+	defer c.Mutex.Unlock()
+	c.csv.Flush()
+	return c.file.Close()
+}
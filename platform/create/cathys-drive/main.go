@@ -1,6 +1,7 @@
 package main
 
 import (
+	"flag"
 	"fmt"
 	"log"
 	"os"
@@ -13,11 +14,14 @@ import (
 )
 
 type TaskInfo struct {
-	infoLog  *log.Logger
-	errorLog *log.Logger
-	ssuData  chan *SensorData
-	botStat  chan *oibot.InfoStatus
-	waitGrp  *sync.WaitGroup
+	infoLog   *log.Logger
+	errorLog  *log.Logger
+	ssuData   chan *SensorData
+	botStat   chan *oibot.InfoStatus
+	waitGrp   *sync.WaitGroup
+	diagBatch int              // frames per diagnostic packet, 0 disables diagnostics
+	capture   *Capture         // destination of diagnostic frames, if any
+	command   *CommandSequence // last user command accepted from the sensor
 }
 
 type SerialInfo struct {
@@ -82,11 +86,13 @@ var (
 		{left: maxWheelVelocityMMPerSec, right: minWheelVelocityMMPerSec},  // DirRightFwd
 		{left: maxWheelVelocityMMPerSec, right: -maxWheelVelocityMMPerSec}, // DirRight
 		{left: maxWheelVelocityMMPerSec, right: -maxWheelVelocityMMPerSec}, // DirRightAft
-		{left: 0, right: 0}, // DirAft
+		{left: -maxWheelVelocityMMPerSec, right: maxWheelVelocityMMPerSec}, // DirAft
 		{left: -maxWheelVelocityMMPerSec, right: maxWheelVelocityMMPerSec}, // DirLeftAft
 	}
 )
 
+// a beacon behind the robot (only seen with the sensor's rear diode array) is
+// turned toward in place, never driven away from.
 var (
 	driveDirection = []driveParams{
 		{velocityMMPerSec: minWheelVelocityMMPerSec, radiusMM: 0x7FFF}, // DirStop
@@ -96,7 +102,7 @@ var (
 		{velocityMMPerSec: maxWheelVelocityMMPerSec, radiusMM: -500},   // DirRightFwd
 		{velocityMMPerSec: maxWheelVelocityMMPerSec, radiusMM: -1},     // DirRight
 		{velocityMMPerSec: maxWheelVelocityMMPerSec, radiusMM: -1},     // DirRightAft
-		{velocityMMPerSec: maxWheelVelocityMMPerSec, radiusMM: 0x7FFF}, // DirAft
+		{velocityMMPerSec: maxWheelVelocityMMPerSec, radiusMM: +1},     // DirAft
 		{velocityMMPerSec: maxWheelVelocityMMPerSec, radiusMM: +1},     // DirLeftAft
 	}
 )
@@ -144,9 +150,12 @@ func oibotTask(task *TaskInfo, serial *SerialInfo, clean TaskSignalQ, ssuSignal
 
 	go func(b *oibot.OIBot, i *TaskInfo, s *SerialInfo, c TaskSignalQ, u TaskSignalQ, w *sync.WaitGroup) {
 		const (
-			baudPulseRateMS       = 10000 * time.Millisecond
-			userCommandDurationMS = 1000 * time.Millisecond
-			driveDurationMS       = 1000 * time.Millisecond
+			baudPulseRateMS = 10000 * time.Millisecond
+			// user commands from the sensor arrive exactly once, but commands
+			// injected from the bot status are repeated with every status until
+			// they take effect, so only act on those once per duration.
+			injectedCommandDurationMS = 1000 * time.Millisecond
+			driveDurationMS           = 1000 * time.Millisecond
 		)
 		defer w.Done()
 		userCommandLastTime := time.Now()
@@ -163,7 +172,7 @@ func oibotTask(task *TaskInfo, serial *SerialInfo, clean TaskSignalQ, ssuSignal
 				}
 				return
 			case dat := <-i.ssuData:
-				if time.Since(userCommandLastTime) > userCommandDurationMS {
+				if !dat.Injected || time.Since(userCommandLastTime) > injectedCommandDurationMS {
 					switch dat.UserCommand {
 					case ucmdPassive:
 						i.infoLog.Printf("sending passive: %+v", dat)
@@ -202,7 +211,7 @@ func oibotTask(task *TaskInfo, serial *SerialInfo, clean TaskSignalQ, ssuSignal
 						dir oibot.Direction
 					)
 
-					if dat.IRIntensity > minIRIntensity {
+					if dat.IRIntensity > noIRIntensity {
 						sym, dir = oibot.AngleRune(dat.IRAngle, 3)
 					} else {
 						sym, dir = oibot.AngleRuneUnknown, oibot.DirStop
@@ -239,6 +248,8 @@ func senseTask(task *TaskInfo, serial *SerialInfo, clean TaskSignalQ, botSignal
 
 	// initialize the object, prepare for entering into state machine
 	ssu := MakeSensor(task.infoLog, task.errorLog, serial.path, serial.baud)
+	ssu.SetDiagnostic(task.diagBatch, task.capture)
+	ssu.SetCommandSequence(task.command)
 
 	wait := &sync.WaitGroup{}
 	wait.Add(2)
@@ -267,26 +278,15 @@ func senseTask(task *TaskInfo, serial *SerialInfo, clean TaskSignalQ, botSignal
 		}
 	}(ssu, task, ssuInSignal, wait, time.Tick(10*time.Millisecond))
 
-	go func(s *Sensor, i *TaskInfo, c TaskSignalQ, w *sync.WaitGroup) {
+	go func(s *Sensor, i *TaskInfo, c TaskSignalQ, w *sync.WaitGroup, t <-chan time.Time) {
 		defer w.Done()
-		for {
-			select {
-			case l := <-c:
-				switch l {
-				case resetSignal:
-					i.errorLog.Printf("caught signal %+v, restarting relay: bot-channel 🠊 ssu-serial", l)
-				default:
-					i.errorLog.Printf("caught signal %+v, terminating relay: bot-channel 🠊 ssu-serial", l)
-				}
-				return
-			case stat := <-i.botStat:
-				if fmt, ok := s.FormatUplinkStatus(stat); ok {
-					s.Write([]byte(fmt))
-				}
-			default:
-			}
+		switch l := s.RelayStatus(i.botStat, c, t); l {
+		case resetSignal:
+			i.errorLog.Printf("caught signal %+v, restarting relay: bot-channel 🠊 ssu-serial", l)
+		default:
+			i.errorLog.Printf("caught signal %+v, terminating relay: bot-channel 🠊 ssu-serial", l)
 		}
-	}(ssu, task, ssuOutSignal, wait)
+	}(ssu, task, ssuOutSignal, wait, time.Tick(1000*time.Millisecond))
 
 	s := waitForSignal(clean, []TaskSignal{}, ssuInSignal, ssuOutSignal)
 
@@ -303,15 +303,34 @@ func main() {
 		}
 	}()
 
-	if len(os.Args) <= 2 {
-		log.Fatalf("usage:\n\t%s <roomba-dev> <sensor-dev>", os.Args[0])
+	capturePath := flag.String("capture", "", "write raw IR diode diagnostic frames to CSV `file`")
+	diagBatch := flag.Int("diag", 0, fmt.Sprintf("raw IR diode diagnostic `frames` per packet (0 to %d, default %d with -capture)", maxDiagBatch, defaultDiagBatch))
+	flag.Parse()
+
+	if flag.NArg() < 2 {
+		log.Fatalf("usage:\n\t%s [-capture file [-diag frames]] <roomba-dev> <sensor-dev>", os.Args[0])
 	}
 
-	botPath := os.Args[1]
+	var capture *Capture
+	if "" != *capturePath {
+		var err error
+		if capture, err = MakeCapture(*capturePath); nil != err {
+			log.Fatal(err)
+		}
+		defer capture.Close()
+		if 0 == *diagBatch {
+			*diagBatch = defaultDiagBatch
+		}
+	} else {
+		// nowhere to put the frames, so don't waste the link bandwidth
+		*diagBatch = 0
+	}
+
+	botPath := flag.Arg(0)
 	botBaud := oibot.DefaultBaudRateBPS
 	botSign := make(TaskSignalQ)
 
-	ssuPath := os.Args[2]
+	ssuPath := flag.Arg(1)
 	ssuBaud := defaultBaudRateBPS // defined in sensor.go
 	ssuSign := make(TaskSignalQ)
 
@@ -319,11 +338,14 @@ func main() {
 	signal.Notify(clean, os.Interrupt, syscall.SIGTERM, syscall.SIGINT, resetSignal)
 
 	task := TaskInfo{
-		infoLog:  log.New(os.Stdout, "[ ] ", log.Ltime),
-		errorLog: log.New(os.Stderr, "[!] ", log.Ltime|log.Lshortfile),
-		ssuData:  make(chan *SensorData),
-		botStat:  make(chan *oibot.InfoStatus),
-		waitGrp:  &sync.WaitGroup{},
+		infoLog:   log.New(os.Stdout, "[ ] ", log.Ltime|log.Lmicroseconds),
+		errorLog:  log.New(os.Stderr, "[!] ", log.Ltime|log.Lmicroseconds|log.Lshortfile),
+		ssuData:   make(chan *SensorData),
+		botStat:   make(chan *oibot.InfoStatus),
+		waitGrp:   &sync.WaitGroup{},
+		diagBatch: *diagBatch,
+		capture:   capture,
+		command:   MakeCommandSequence(),
 	}
 
 	task.waitGrp.Add(2)
@@ -378,6 +400,10 @@ func main() {
 
 	go func(i *TaskInfo, f chan interface{}) {
 		i.waitGrp.Wait()
+		if nil != i.capture {
+			packets, lost := i.capture.Stats()
+			task.infoLog.Printf("captured %d diagnostic packets (%d lost)", packets, lost)
+		}
 		task.infoLog.Print("exiting gracefully")
 		f <- true // value unused
 	}(&task, finished)
@@ -1,11 +1,17 @@
 package main
 
 import (
+	"bufio"
+	"bytes"
 	"encoding/json"
 	"fmt"
+	"io"
 	"log"
 	"math"
+	"os"
 	"strings"
+	"sync"
+	"time"
 
 	"github.com/ardnew/oibot"
 
@@ -14,7 +20,7 @@ import (
 
 const (
 	defaultBaudRateBPS int     = 115200
-	minIRIntensity     float32 = 100.0 / 6.0 // num IR diodes == 6
+	noIRIntensity      float32 = -1.0 // sent whenever the sensor detects no signal
 )
 
 const (
@@ -28,18 +34,48 @@ const (
 	ucmdCOUNT
 )
 
+// user commands are numbered by the sensor, starting over at 1 after 255. the
+// value 0 is never assigned, and on the downlink acknowledges nothing.
+const cmdSeqNONE uint8 = 0
+
+// CommandSequence records the last user command accepted from the sensor. it
+// outlives any one Sensor so that a command retransmitted across a restart of
+// the sensor task is still recognized as a duplicate.
+type CommandSequence struct {
+	last uint8
+}
+
+func MakeCommandSequence() *CommandSequence {
+	return &CommandSequence{last: cmdSeqNONE}
+}
+
 type Sensor struct {
-	port     *serial.Port
-	infoLog  *log.Logger
-	errorLog *log.Logger
-	path     string
-	baud     int
+	port      io.ReadWriter // the serial port, or any stand-in for it
+	reader    *bufio.Reader
+	infoLog   *log.Logger
+	errorLog  *log.Logger
+	path      string
+	baud      int
+	diagBatch int      // frames per diagnostic packet requested, 0 disables
+	capture   *Capture // destination of diagnostic packets, if any
+	command   *CommandSequence
+	writeMtx  *sync.Mutex       // status is written by both relay goroutines
+	lastStat  *oibot.InfoStatus // most recent status, repeated with each ack
 }
 
 type SensorData struct {
-	UserCommand int16   `json:"user-command"`
-	IRAngle     int16   `json:"ir-angle"`
-	IRIntensity float32 `json:"ir-intensity"`
+	TimeUS      uint32   `json:"time-us"` // sensor clock, wraps every ~71.6 minutes
+	UserCommand int16    `json:"user-command"`
+	CommandSeq  uint8    `json:"cmd-seq"`
+	IRAngle     int16    `json:"ir-angle"`
+	IRIntensity float32  `json:"ir-intensity"`
+	DutyCycle   *float32 `json:"duty-cycle"`     // percent awake, sent about once per second
+	PollJitter  *float32 `json:"poll-jitter-us"` // std. deviation of IR poll lateness, same window
+	PollLate    *uint32  `json:"poll-late-us"`   // worst IR poll lateness, same window
+	CmdDeferred *uint32  `json:"cmd-deferred"`   // user commands the sensor had to hold back, total
+	BytesDrop   *uint32  `json:"bytes-dropped"`  // telemetry and diagnostic output the sensor discarded, total
+	ArenaFail   *uint32  `json:"arena-failures"` // allocations the static arena could not fit, if enabled
+	ArenaLate   *uint32  `json:"arena-late"`     // allocations after setup(), if enabled
 	Injected    bool
 }
 
@@ -48,7 +84,8 @@ func MakeSensor(infoLog *log.Logger, errorLog *log.Logger, path string, baud int
 	if port, err := serial.OpenPort(&serial.Config{Name: path, Baud: baud}); nil != err {
 		errorLog.Panic(fmt.Errorf("failed to open serial port: %s (%d): %s", path, baud, err))
 	} else {
-		s = &Sensor{port: port, infoLog: infoLog, errorLog: errorLog, path: path, baud: baud}
+		s = &Sensor{port: port, reader: bufio.NewReader(port), infoLog: infoLog, errorLog: errorLog, path: path, baud: baud,
+			command: MakeCommandSequence(), writeMtx: &sync.Mutex{}}
 	}
 	return s
 }
@@ -63,44 +100,133 @@ func (s *Sensor) Read(buf []byte) int {
 	return count
 }
 
+// SetDiagnostic requests raw diagnostic streaming from the sensor (batched per
+// packet, clamped to maxDiagBatch) with each packet received written to the
+// given capture. a batch of 0 disables streaming.
+func (s *Sensor) SetDiagnostic(batch int, capture *Capture) {
+	if batch > maxDiagBatch {
+		batch = maxDiagBatch
+	}
+	if batch < 0 {
+		batch = 0
+	}
+	s.diagBatch = batch
+	s.capture = capture
+}
+
+// SetCommandSequence shares the record of accepted user commands, which should
+// be the same for every Sensor opened on the same device.
+func (s *Sensor) SetCommandSequence(command *CommandSequence) {
+	s.command = command
+}
+
+// acceptCommand acknowledges the user command carried by the given message,
+// and returns false if it was already accepted (i.e., a retransmission whose
+// acknowledgement the sensor did not receive in time).
+func (s *Sensor) acceptCommand(data *SensorData) bool {
+	s.writeMtx.Lock()
+	defer s.writeMtx.Unlock()
+	accept := data.CommandSeq != s.command.last
+	s.command.last = data.CommandSeq
+	// acknowledge right away rather than with the next periodic status. the
+	// sensor keeps streaming telemetry meanwhile, but it delivers commands one
+	// at a time: until this one is acknowledged it is resent every 100ms (the
+	// duplicates being discarded above), and any further button presses wait
+	// behind it.
+	status, _ := s.formatUplinkStatus(s.lastStat)
+	s.write([]byte(status))
+	return accept
+}
+
+// lineBuffered returns true if a complete line can be read without blocking.
+func (s *Sensor) lineBuffered() bool {
+	buf, _ := s.reader.Peek(s.reader.Buffered())
+	return bytes.IndexByte(buf, '\n') >= 0
+}
+
+// Data returns the most recent message from the sensor. it blocks until one
+// arrives, then drains every complete line already buffered, since the sensor
+// sends a message with each frame (up to 250 Hz, plus any diagnostic packets)
+// and reading only one per call would leave us ever further behind it. a
+// message carrying a user command is returned as soon as it is read, so that
+// no command is ever skipped.
 func (s *Sensor) Data() (*SensorData, bool) {
-	// for help with the magic numbers used here, see the JSON output definition
-	// in cathys-sensor.ino as well as the calculator tool (for the serialization
-	// lib used in that project) here:
-	//   https://arduinojson.org/v6/assistant/
 	const (
-		jsonObjSize     = 16
-		jsonObjCount    = 3
-		jsonStringsSize = 35                 // the sum of all key identifiers
-		jsonMarkupSize  = 2 + 4*jsonObjCount // outer brackets and key delimiters
-		jsonDataSize    = jsonObjSize*jsonObjCount + jsonStringsSize + jsonMarkupSize + 1
-
-		// the buffer is twice as big as one JSON struct so that we can guarantee
-		// to have a newline delimiter somewhere in the stream, since our reads do
-		// not necessarily begin or end with any relation to the JSON delimiters.
-		jsonBufSize = 1.5*jsonDataSize + 1
+		// the sensor stream also carries diagnostic packet lines, so we may need
+		// to skip over a number of them before reaching the most recent message.
+		// this only bounds the time spent in any one call.
+		maxLinesPerRead = 128
 	)
 	var (
-		data = SensorData{UserCommand: ucmdNONE, IRAngle: -1, IRIntensity: -1, Injected: false}
+		data  = SensorData{UserCommand: ucmdNONE, IRAngle: -1, IRIntensity: -1, Injected: false}
+		found = false
 	)
-	buf := make([]byte, jsonBufSize)
-	if s.Read(buf) > 0 {
-		for _, str := range strings.Fields(string(buf)) {
-			// do a preliminary sanity check before trying to unmarshal. this really
-			// only helps reduce the number of errors logged to output.
-			if strings.HasPrefix(str, "{") && strings.HasSuffix(str, "}") {
-				if err := json.Unmarshal([]byte(str), &data); nil != err {
-					//s.errorLog.Printf("failed to unmarshal JSON data: %+v", str)
-				} else {
+	for n := 0; n < maxLinesPerRead; n++ {
+		if found && !s.lineBuffered() {
+			break
+		}
+		line, err := s.reader.ReadString('\n')
+		if nil != err {
+			s.errorLog.Panic(fmt.Errorf("failed to read from serial port: %s", err))
+		}
+		str := strings.TrimSpace(line)
+		switch {
+		case strings.HasPrefix(str, diagLinePrefix):
+			if nil == s.capture {
+				break
+			}
+			if pkt, err := DecodeDiagnostic(str); nil != err {
+				s.errorLog.Printf("failed to decode diagnostic packet: %s", err)
+			} else if err := s.capture.Write(pkt); nil != err {
+				s.errorLog.Printf("failed to write diagnostic capture: %s", err)
+			}
+		// do a preliminary sanity check before trying to unmarshal. this really
+		// only helps reduce the number of errors logged to output.
+		case strings.HasPrefix(str, "{") && strings.HasSuffix(str, "}"):
+			next := SensorData{UserCommand: ucmdNONE, IRAngle: -1, IRIntensity: -1, Injected: false}
+			if err := json.Unmarshal([]byte(str), &next); nil != err {
+				//s.errorLog.Printf("failed to unmarshal JSON data: %+v", str)
+			} else {
+				if nil != next.DutyCycle {
+					s.infoLog.Printf("sensor: duty cycle=%.1f%%", *next.DutyCycle)
+				}
+				if nil != next.PollJitter && nil != next.PollLate {
+					s.infoLog.Printf("sensor: poll jitter=%.0fus, worst=%dus", *next.PollJitter, *next.PollLate)
+				}
+				if nil != next.CmdDeferred && *next.CmdDeferred > 0 {
+					s.infoLog.Printf("sensor: user commands deferred=%d", *next.CmdDeferred)
+				}
+				if nil != next.BytesDrop && *next.BytesDrop > 0 {
+					s.infoLog.Printf("sensor: output bytes dropped=%d", *next.BytesDrop)
+				}
+				if nil != next.ArenaFail && nil != next.ArenaLate && (*next.ArenaFail > 0 || *next.ArenaLate > 0) {
+					s.errorLog.Printf("sensor: static arena failures=%d, late allocations=%d", *next.ArenaFail, *next.ArenaLate)
+				}
+				if ucmdNONE != next.UserCommand && !s.acceptCommand(&next) {
+					// already acted upon, the rest is still current telemetry
+					next.UserCommand = ucmdNONE
+				}
+				data, found = next, true
+				if ucmdNONE != data.UserCommand {
 					return &data, true
 				}
 			}
 		}
 	}
+	if found {
+		return &data, true
+	}
 	return nil, false
 }
 
 func (s *Sensor) FormatUplinkStatus(stat *oibot.InfoStatus) (string, bool) {
+	s.writeMtx.Lock()
+	defer s.writeMtx.Unlock()
+	s.lastStat = stat
+	return s.formatUplinkStatus(stat)
+}
+
+func (s *Sensor) formatUplinkStatus(stat *oibot.InfoStatus) (string, bool) {
 
 	var validMode bool
 
@@ -119,12 +245,46 @@ func (s *Sensor) FormatUplinkStatus(stat *oibot.InfoStatus) (string, bool) {
 			botStatusBatt = 0
 			connectedFlag = 1
 		}
-		return fmt.Sprintf("%d %s %d\n", connectedFlag, botStatusMode, botStatusBatt), true
+		return fmt.Sprintf("%d %s %d %d %d\n", connectedFlag, botStatusMode, botStatusBatt, s.diagBatch, s.command.last), true
+	}
+	return fmt.Sprintf("%d %s %d %d %d\n", connectedFlag, botStatusMode, botStatusBatt, s.diagBatch, s.command.last), false
+}
+
+// RelayStatus writes the downlink status line to the sensor for every robot
+// status received on stat, and on every tick of t in which none was received,
+// until a signal arrives on c, which it returns. the line is written even
+// without a valid robot status (conn=0), since the sensor holds back all user
+// commands until it has heard from us, and those include the very commands
+// (Reset, Passive, Safe) that recover an unresponsive or disconnected robot.
+func (s *Sensor) RelayStatus(stat <-chan *oibot.InfoStatus, c TaskSignalQ, t <-chan time.Time) os.Signal {
+	heard := false
+	for {
+		select {
+		case l := <-c:
+			return l
+		case st := <-stat:
+			status, _ := s.FormatUplinkStatus(st)
+			s.Write([]byte(status))
+			heard = true
+		case <-t:
+			// the robot task may be stalled, or restarting after failing to open
+			// its serial port, and is sending no status at all.
+			if !heard {
+				status, _ := s.FormatUplinkStatus(nil)
+				s.Write([]byte(status))
+			}
+			heard = false
+		}
 	}
-	return fmt.Sprintf("%d %s %d\n", connectedFlag, botStatusMode, botStatusBatt), false
 }
 
 func (s *Sensor) Write(buf []byte) {
+	s.writeMtx.Lock()
+	defer s.writeMtx.Unlock()
+	s.write(buf)
+}
+
+func (s *Sensor) write(buf []byte) {
 	if n, err := s.port.Write(buf); n <= 0 || nil != err {
 		s.errorLog.Printf("failed to write to serial port: %+v: %s", buf, err)
 	}
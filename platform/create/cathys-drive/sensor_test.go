@@ -0,0 +1,78 @@
+package main
+
+import (
+	"bufio"
+	"bytes"
+	"io"
+	"io/ioutil"
+	"log"
+	"os"
+	"strings"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/ardnew/oibot"
+)
+
+// with no robot status available, the sensor must still hear from us, or it
+// never sends the user commands that would recover the robot.
+func TestRelayStatusWithoutRobot(t *testing.T) {
+	port := &bytes.Buffer{}
+	s := &Sensor{port: port, errorLog: log.New(ioutil.Discard, "", 0),
+		command: MakeCommandSequence(), writeMtx: &sync.Mutex{}}
+	s.command.last = 7
+
+	var (
+		stat = make(chan *oibot.InfoStatus)
+		sig  = make(TaskSignalQ)
+		tick = make(chan time.Time)
+		done = make(chan os.Signal)
+	)
+	go func() { done <- s.RelayStatus(stat, sig, tick) }()
+
+	stat <- nil        // the robot did not answer its status query
+	tick <- time.Now() // a status was relayed this period, nothing more to do
+	tick <- time.Now() // the robot task sent nothing at all this period
+	sig <- resetSignal
+	if l := <-done; resetSignal != l {
+		t.Fatalf("RelayStatus returned %v, want %v", l, resetSignal)
+	}
+
+	want := "0 N/C 0 0 7\n0 N/C 0 0 7\n"
+	if got := port.String(); want != got {
+		t.Errorf("downlink without robot = %q, want %q", got, want)
+	}
+}
+
+// Data must catch up with a sensor that sends faster than it is polled, but
+// never skip a user command on the way.
+func TestDataDrainsToNewest(t *testing.T) {
+	in := strings.NewReader(strings.Join([]string{
+		`{"time-us":1,"ir-angle":10,"ir-intensity":50}`,
+		`{"time-us":2,"ir-angle":20,"ir-intensity":50,"user-command":3,"cmd-seq":1}`,
+		`{"time-us":3,"ir-angle":30,"ir-intensity":50}`,
+		`{"time-us":4,"ir-angle":40,"ir-intensity":50}`,
+	}, "\n") + "\n")
+	port := struct {
+		io.Reader
+		io.Writer
+	}{in, &bytes.Buffer{}}
+	discard := log.New(ioutil.Discard, "", 0)
+	s := &Sensor{port: port, reader: bufio.NewReader(port), infoLog: discard, errorLog: discard,
+		command: MakeCommandSequence(), writeMtx: &sync.Mutex{}}
+
+	for _, want := range []struct {
+		timeUS  uint32
+		command int16
+	}{{2, 3}, {4, ucmdNONE}} {
+		data, ok := s.Data()
+		if !ok {
+			t.Fatalf("no data, want time-us=%d", want.timeUS)
+		}
+		if want.timeUS != data.TimeUS || want.command != data.UserCommand {
+			t.Errorf("data time-us=%d user-command=%d, want time-us=%d user-command=%d",
+				data.TimeUS, data.UserCommand, want.timeUS, want.command)
+		}
+	}
+}
@@ -0,0 +1,216 @@
+package main
+
+import (
+	"encoding/csv"
+	"fmt"
+	"io"
+	"math"
+	"math/rand"
+	"os"
+	"strconv"
+	"strings"
+)
+
+// a diode log is a capture written by cathys-drive (-capture), i.e. one row
+// per raw frame with columns time-us, sequence, ir-diode-1, ..., ir-diode-N,
+// plus a beacon-deg column giving the true bearing of the beacon in each
+// frame (empty while the beacon is hidden). captures from the robot must be
+// annotated with that column by hand before they can be scored.
+const (
+	truthColumn = "beacon-deg"
+	sampleMax   = 8191 // IR_SAMPLE_MAX, with 13-bit samples
+)
+
+type Log struct {
+	Name     string
+	NumDiode int
+	TimeUS   []uint32
+	Value    []int16   // frame-major, NumDiode values per frame
+	Truth    []float32 // degrees, NaN while the beacon is hidden
+}
+
+func (l *Log) Len() int { return len(l.TimeUS) }
+
+func (l *Log) Frame(f int) []int16 {
+	return l.Value[f*l.NumDiode : (f+1)*l.NumDiode]
+}
+
+func LoadLog(path string) (*Log, error) {
+	file, err := os.Open(path)
+	if nil != err {
+		return nil, fmt.Errorf("failed to open log: %s: %s", path, err)
+	}
+	defer file.Close()
+
+	r := csv.NewReader(file)
+	header, err := r.Read()
+	if nil != err {
+		return nil, fmt.Errorf("failed to read log header: %s: %s", path, err)
+	}
+	var (
+		timeCol  = -1
+		truthCol = -1
+		diodeCol []int
+	)
+	for i, name := range header {
+		switch {
+		case "time-us" == name:
+			timeCol = i
+		case truthColumn == name:
+			truthCol = i
+		case strings.HasPrefix(name, "ir-diode-"):
+			diodeCol = append(diodeCol, i)
+		}
+	}
+	if timeCol < 0 || 0 == len(diodeCol) {
+		return nil, fmt.Errorf("not a diode log (no time-us or ir-diode-N columns): %s", path)
+	}
+	if truthCol < 0 {
+		return nil, fmt.Errorf("log has no %s column, it cannot be scored: %s", truthColumn, path)
+	}
+
+	l := &Log{Name: path, NumDiode: len(diodeCol)}
+	for line := 2; ; line++ {
+		row, err := r.Read()
+		if io.EOF == err {
+			break
+		}
+		if nil != err {
+			return nil, fmt.Errorf("failed to read log: %s: %s", path, err)
+		}
+		t, err := strconv.ParseUint(row[timeCol], 10, 32)
+		if nil != err {
+			return nil, fmt.Errorf("%s:%d: invalid time: %s", path, line, err)
+		}
+		l.TimeUS = append(l.TimeUS, uint32(t))
+		for _, c := range diodeCol {
+			v, err := strconv.ParseInt(row[c], 10, 16)
+			if nil != err {
+				return nil, fmt.Errorf("%s:%d: invalid diode value: %s", path, line, err)
+			}
+			l.Value = append(l.Value, int16(v))
+		}
+		truth := float32(math.NaN())
+		if s := strings.TrimSpace(row[truthCol]); "" != s {
+			d, err := strconv.ParseFloat(s, 32)
+			if nil != err {
+				return nil, fmt.Errorf("%s:%d: invalid %s: %s", path, line, truthColumn, err)
+			}
+			truth = float32(d)
+		}
+		l.Truth = append(l.Truth, truth)
+	}
+	if l.Len() < 2 {
+		return nil, fmt.Errorf("log has too few frames: %s", path)
+	}
+	return l, nil
+}
+
+func (l *Log) Write(path string) error {
+	file, err := os.Create(path)
+	if nil != err {
+		return fmt.Errorf("failed to create log: %s: %s", path, err)
+	}
+	defer file.Close()
+
+	w := csv.NewWriter(file)
+	header := []string{"time-us", "sequence"}
+	for i := 1; i <= l.NumDiode; i++ {
+		header = append(header, fmt.Sprintf("ir-diode-%d", i))
+	}
+	w.Write(append(header, truthColumn))
+	row := make([]string, len(header)+1)
+	for f := 0; f < l.Len(); f++ {
+		row[0] = strconv.FormatUint(uint64(l.TimeUS[f]), 10)
+		row[1] = "0"
+		for i, v := range l.Frame(f) {
+			row[2+i] = strconv.Itoa(int(v))
+		}
+		row[len(row)-1] = ""
+		if !math.IsNaN(float64(l.Truth[f])) {
+			row[len(row)-1] = strconv.FormatFloat(float64(l.Truth[f]), 'f', 1, 32)
+		}
+		w.Write(row)
+	}
+	w.Flush()
+	return w.Error()
+}
+
+// synthetic logs model a beacon that jumps to a random bearing every few
+// seconds, sometimes disappearing, and otherwise drifts slowly, under a random
+// level of ambient light. each diode sees the beacon through a cosine-shaped
+// lobe about its own bearing, the beacon's brightness flickers from frame to
+// frame, and every reading carries gaussian noise. smaller readings are
+// brighter.
+const (
+	synthPeriodUS    = 10000 // IR_POLL_START_US
+	synthJitterUS    = 500
+	synthHoldMinS    = 3.0
+	synthHoldMaxS    = 8.0
+	synthHiddenProb  = 0.2
+	synthDriftMax    = 20.0 // degrees per second
+	synthFlicker     = 0.3  // relative deviation of the beacon's brightness
+	synthLobeDeg     = 45.0 // half-width of each diode's response
+	synthAmbientMin  = 4000
+	synthAmbientMax  = 7800
+	synthDepthMin    = 80 // beacon brightness, in counts below ambient
+	synthDepthMax    = 2500
+	synthNoiseMin    = 4.0
+	synthNoiseMax    = 40.0
+	synthArrayBounds = 90.0 // ANGLE_MAX_DEG
+)
+
+func MakeSyntheticLog(name string, rng *rand.Rand, numDiode int, seconds float64) *Log {
+	var (
+		l       = &Log{Name: name, NumDiode: numDiode}
+		bearing = DiodeBearings(numDiode)
+		ambient = synthAmbientMin + rng.Float64()*(synthAmbientMax-synthAmbientMin)
+		noise   = synthNoiseMin + rng.Float64()*(synthNoiseMax-synthNoiseMin)
+		span    = synthArrayBounds
+		t       = uint32(rng.Intn(synthPeriodUS))
+		next    = 0.0
+		truth   = math.NaN()
+		depth   = 0.0
+		drift   = 0.0
+		last    = 0.0
+	)
+	if numDiode > 6 {
+		span = 180.0 // front and rear arrays
+	}
+	for now := 0.0; now < seconds; now = float64(t-l.TimeUS[0]) / 1e6 {
+		if 0 == len(l.TimeUS) || now >= next {
+			next = now + synthHoldMinS + rng.Float64()*(synthHoldMaxS-synthHoldMinS)
+			if rng.Float64() < synthHiddenProb {
+				truth = math.NaN()
+			} else {
+				truth = math.Round(-span + rng.Float64()*2*span)
+				depth = synthDepthMin + rng.Float64()*(synthDepthMax-synthDepthMin)
+				drift = synthDriftMax * (2*rng.Float64() - 1)
+			}
+		} else if !math.IsNaN(truth) {
+			truth += drift * (now - last)
+			if numDiode > 6 {
+				truth = wrapDegrees(truth)
+			} else if math.Abs(truth) > span { // turn back at the edge of the array
+				truth = math.Copysign(span, truth)
+				drift = -drift
+			}
+		}
+		last = now
+		l.TimeUS = append(l.TimeUS, t)
+		l.Truth = append(l.Truth, float32(truth))
+		flicker := math.Max(0, 1+synthFlicker*rng.NormFloat64())
+		for i := 0; i < numDiode; i++ {
+			v := ambient + rng.NormFloat64()*noise
+			if !math.IsNaN(truth) {
+				off := math.Abs(wrapDegrees(truth - bearing[i]))
+				if off < 2*synthLobeDeg {
+					v -= flicker * depth * 0.5 * (1 + math.Cos(math.Pi*off/(2*synthLobeDeg)))
+				}
+			}
+			l.Value = append(l.Value, int16(math.Max(0, math.Min(sampleMax, math.Round(v)))))
+		}
+		t += uint32(synthPeriodUS - synthJitterUS + rng.Intn(2*synthJitterUS+1))
+	}
+	return l
+}
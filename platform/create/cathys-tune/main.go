@@ -0,0 +1,193 @@
+package main
+
+// cathys-tune searches for the sensor pipeline constants that best trade off
+// bearing accuracy against response time, by replaying recorded (or synthetic)
+// raw diode logs through a model of the Cathys_Sensor pipeline for every
+// combination of the swept parameters:
+//
+//   sample window  IR_SAMPLE_WINDOW_MS
+//   filter         the rolling mean (window) or an exponential mean (ewma)
+//   source         bearing of the brightest diode, or the centroid of all
+//   acquire        IR_SNR_ACQUIRE
+//   release        IR_SNR_RELEASE
+//   smoothing      IR_SNR_SMOOTHING_MS
+//
+// combinations are evaluated in parallel on every CPU core, and the ones on
+// the Pareto front of mean steady-state bearing error versus mean response
+// latency are reported: those for which no other combination is both more
+// accurate and faster.
+
+import (
+	"flag"
+	"fmt"
+	"log"
+	"math/rand"
+	"os"
+	"path/filepath"
+	"runtime"
+	"sort"
+	"text/tabwriter"
+	"time"
+)
+
+// the constants the firmware currently ships with, for reference
+var firmwareParams = Params{
+	WindowMS:    2500,
+	Filter:      filterWindow,
+	Source:      sourceBrightest,
+	Acquire:     6,
+	Release:     3,
+	SmoothingMS: 100,
+}
+
+var (
+	sweepWindowMS    = []int{250, 500, 750, 1000, 1250, 1500, 1750, 2000, 2250, 2500, 2750, 3000}
+	sweepAcquire     = []float32{3, 4, 5, 6, 7, 8, 10, 12}
+	sweepRelease     = []float32{0.3, 0.5, 0.7} // fraction of acquire
+	sweepSmoothingMS = []int{0, 25, 50, 100, 200}
+)
+
+func MakeGrid() []Params {
+	var grid []Params
+	for _, window := range sweepWindowMS {
+		for filter := Filter(0); filter < filterCOUNT; filter++ {
+			for source := Source(0); source < sourceCOUNT; source++ {
+				for _, acquire := range sweepAcquire {
+					for _, release := range sweepRelease {
+						for _, smoothing := range sweepSmoothingMS {
+							grid = append(grid, Params{
+								WindowMS:    window,
+								Filter:      filter,
+								Source:      source,
+								Acquire:     acquire,
+								Release:     acquire * release,
+								SmoothingMS: smoothing,
+							})
+						}
+					}
+				}
+			}
+		}
+	}
+	return grid
+}
+
+type Result struct {
+	Params
+	Score
+}
+
+// ParetoFront returns the results that no other result beats on both error
+// and latency, in order of increasing error.
+func ParetoFront(result []Result) []Result {
+	sorted := append([]Result{}, result...)
+	sort.Slice(sorted, func(i, j int) bool {
+		if sorted[i].Error() != sorted[j].Error() {
+			return sorted[i].Error() < sorted[j].Error()
+		}
+		return sorted[i].LatencyMS() < sorted[j].LatencyMS()
+	})
+	var front []Result
+	for _, r := range sorted {
+		if 0 == len(front) || r.LatencyMS() < front[len(front)-1].LatencyMS() {
+			front = append(front, r)
+		}
+	}
+	return front
+}
+
+func report(front []Result, firmware Result) {
+	w := tabwriter.NewWriter(os.Stdout, 0, 4, 2, ' ', tabwriter.AlignRight)
+	fmt.Fprintln(w, "window\tfilter\tsource\tacquire\trelease\tsmoothing\terror\tlatency\tmisdetect\t")
+	for _, r := range front {
+		fmt.Fprintf(w, "%dms\t%s\t%s\t%.1f\t%.1f\t%dms\t%.1f°\t%.0fms\t%.1f%%\t\n",
+			r.WindowMS, filterName[r.Filter], sourceName[r.Source], r.Acquire, r.Release,
+			r.SmoothingMS, r.Error(), r.LatencyMS(), r.MisdetectedPct())
+	}
+	w.Flush()
+	fmt.Printf("firmware constants: %.1f° error, %.0fms latency, %.1f%% misdetect\n",
+		firmware.Error(), firmware.LatencyMS(), firmware.MisdetectedPct())
+}
+
+func main() {
+
+	numSynth := flag.Int("synth", 0, "number of synthetic `logs` to generate (default 8 if no log files are given)")
+	synthDiodes := flag.Int("synth-diodes", 6, "diodes per synthetic log (6 = front array, 12 = front and rear)")
+	synthLength := flag.Duration("synth-length", 2*time.Minute, "length of each synthetic log")
+	synthOut := flag.String("synth-out", "", "also write the synthetic logs as CSV to this `directory`")
+	seed := flag.Int64("seed", 1, "random seed for the synthetic logs")
+	workers := flag.Int("workers", runtime.NumCPU(), "number of worker threads")
+	settle := flag.Duration("settle", 3*time.Second, "time after each change before bearing error is measured, must exceed the longest window")
+	tolerance := flag.Float64("tolerance", 15, "bearing error in degrees within which the output has responded to a change")
+	penalty := flag.Float64("penalty", 90, "bearing error in degrees charged for a missed or false detection")
+	flag.Usage = func() {
+		fmt.Fprintf(flag.CommandLine.Output(), "usage: %s [flags] [log.csv ...]\n", os.Args[0])
+		flag.PrintDefaults()
+	}
+	flag.Parse()
+
+	infoLog := log.New(os.Stderr, "[ ] ", log.Ltime)
+
+	var logs []*Log
+	for _, path := range flag.Args() {
+		l, err := LoadLog(path)
+		if nil != err {
+			log.Fatal(err)
+		}
+		logs = append(logs, l)
+	}
+	if 0 == *numSynth && 0 == len(logs) {
+		*numSynth = 8
+	}
+	if *synthDiodes <= 0 || 0 != *synthDiodes%diodesPerArray || *synthDiodes > 2*diodesPerArray {
+		log.Fatalf("unsupported number of synthetic diodes: %d", *synthDiodes)
+	}
+	rng := rand.New(rand.NewSource(*seed))
+	for i := 0; i < *numSynth; i++ {
+		l := MakeSyntheticLog(fmt.Sprintf("synth-%d", i+1), rng, *synthDiodes, synthLength.Seconds())
+		if "" != *synthOut {
+			if err := l.Write(filepath.Join(*synthOut, l.Name+".csv")); nil != err {
+				log.Fatal(err)
+			}
+		}
+		logs = append(logs, l)
+	}
+	if *workers < 1 {
+		*workers = 1
+	}
+
+	sc := Scoring{
+		SettleUS:     uint32(*settle / time.Microsecond),
+		ToleranceDeg: float32(*tolerance),
+		PenaltyDeg:   float32(*penalty),
+	}
+	start := time.Now()
+	var (
+		front  = make([]*Frontend, len(logs))
+		frames = 0
+	)
+	for i, l := range logs {
+		front[i] = MakeFrontend(l, sc)
+		frames += l.Len()
+	}
+
+	grid := MakeGrid()
+	result := make([]Result, len(grid))
+	pool := MakePool(*workers, len(grid))
+	pool.Run(func(worker, task int) {
+		r := Result{Params: grid[task]}
+		for _, fe := range front {
+			r.Score.Add(Evaluate(fe, r.Params, sc))
+		}
+		result[task] = r
+	})
+	elapsed := time.Since(start)
+
+	infoLog.Printf("evaluated %d combinations over %d log(s) (%d frames) in %v on %d worker(s), %d steal(s)",
+		len(grid), len(logs), frames, elapsed.Round(time.Millisecond), *workers, pool.Steals())
+	firmware := Result{Params: firmwareParams}
+	for _, fe := range front {
+		firmware.Score.Add(Evaluate(fe, firmwareParams, sc))
+	}
+	report(ParetoFront(result), firmware)
+}
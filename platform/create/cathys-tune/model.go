@@ -0,0 +1,378 @@
+package main
+
+import (
+	"math"
+)
+
+// a host-side model of the Cathys_Sensor pipeline (cathys-sensor.h and
+// noise-floor.h), replayed over the frames of a diode log. the front end (each
+// diode's noise floor and signal-to-noise ratio) does not depend on any of the
+// swept parameters, so it is computed once per log and shared by every
+// evaluation; only the detector and the bearing filter are re-run.
+
+const (
+	arrayMinDeg    = -90 // ANGLE_MIN_DEG
+	arrayMaxDeg    = 90  // ANGLE_MAX_DEG
+	diodesPerArray = 6   // IR_DIODES_PER_ARRAY
+
+	noiseFloorRiseUS  = 500e3    // NOISE_FLOOR_RISE_MS
+	noiseFloorFallUS  = 5000e3   // NOISE_FLOOR_FALL_MS
+	noiseFloorHoldUS  = 300000e3 // NOISE_FLOOR_HOLD_MS
+	noiseSpreadUS     = 2000e3   // NOISE_SPREAD_MS
+	noiseSpreadMin    = 2.0      // NOISE_SPREAD_MIN
+	noiseSpreadStart  = 8.0 * 8  // NOISE_SPREAD_START, with 13-bit samples
+	noiseOutlier      = 3.0      // NOISE_OUTLIER
+	noiseAmbientShift = 0.75     // NOISE_AMBIENT_SHIFT
+)
+
+// DiodeBearings returns the bearing of each diode, front array first, the
+// same as the Cathys_Sensor constructor.
+func DiodeBearings(numDiode int) []float64 {
+	bearing := make([]float64, numDiode)
+	for i := range bearing {
+		a, j := i/diodesPerArray, i%diodesPerArray
+		bearing[i] = wrapDegrees(float64(180*a+arrayMinDeg) +
+			float64(arrayMaxDeg-arrayMinDeg)*float64(j)/(diodesPerArray-1))
+	}
+	return bearing
+}
+
+func wrapDegrees(deg float64) float64 { // into (-180°, 180°]
+	for deg <= -180 {
+		deg += 360
+	}
+	for deg > 180 {
+		deg -= 360
+	}
+	return deg
+}
+
+func ewmaWeight(dtUS float32, tauUS float32) float32 {
+	if tauUS <= 0 {
+		return 1
+	}
+	if w := dtUS / tauUS; w < 1 {
+		return w
+	}
+	return 1
+}
+
+// Frontend holds the parameter-independent part of the pipeline for one log,
+// along with the truth it is scored against, as flat per-frame slices so that
+// the evaluation loops stay simple and free of trigonometry where possible.
+type Frontend struct {
+	Log       *Log
+	DtUS      []float32 // time since the previous frame
+	SNR       []float32 // ratio of the clearest diode
+	BrightX   []float32 // unit vector of the brightest diode's bearing
+	BrightY   []float32
+	CentroidX []float32 // unit vector of the SNR-weighted mean of all diodes
+	CentroidY []float32
+	Present   []bool    // the beacon is in view
+	TruthX    []float32 // unit vector of the beacon's bearing
+	TruthY    []float32
+	Change    []bool // the beacon moved, appeared, or disappeared
+}
+
+func MakeFrontend(l *Log, sc Scoring) *Frontend {
+	var (
+		n       = l.Len()
+		fe      = &Frontend{Log: l}
+		bearing = DiodeBearings(l.NumDiode)
+		ux      = make([]float32, l.NumDiode)
+		uy      = make([]float32, l.NumDiode)
+		level   = make([]float32, l.NumDiode)
+		spread  = make([]float32, l.NumDiode)
+		snr     = make([]float32, l.NumDiode)
+	)
+	fe.DtUS = make([]float32, n)
+	fe.SNR = make([]float32, n)
+	fe.BrightX = make([]float32, n)
+	fe.BrightY = make([]float32, n)
+	fe.CentroidX = make([]float32, n)
+	fe.CentroidY = make([]float32, n)
+	fe.Present = make([]bool, n)
+	fe.TruthX = make([]float32, n)
+	fe.TruthY = make([]float32, n)
+	fe.Change = make([]bool, n)
+	for f, truth := range l.Truth {
+		fe.Present[f] = !math.IsNaN(float64(truth))
+		if fe.Present[f] {
+			fe.TruthX[f] = float32(math.Cos(float64(truth) * math.Pi / 180))
+			fe.TruthY[f] = float32(math.Sin(float64(truth) * math.Pi / 180))
+		}
+		fe.Change[f] = f > 0 && changed(l.Truth[f-1], truth, sc.ToleranceDeg)
+	}
+	for i, b := range bearing {
+		ux[i] = float32(math.Cos(b * math.Pi / 180))
+		uy[i] = float32(math.Sin(b * math.Pi / 180))
+		spread[i] = noiseSpreadStart
+	}
+
+	for f := 0; f < n; f++ {
+		value := l.Frame(f)
+		if 0 == f {
+			// the floors are primed with the first frame, which has no ratio
+			for i, v := range value {
+				level[i] = float32(v)
+			}
+			fe.DtUS[f] = 0
+		} else {
+			fe.DtUS[f] = float32(l.TimeUS[f] - l.TimeUS[f-1])
+		}
+
+		brightest := 0
+		brighter := 0
+		var best, cx, cy float32
+		for i, v := range value {
+			if v < value[brightest] {
+				brightest = i
+			}
+			if f > 0 {
+				snr[i] = (level[i] - float32(v)) / spread[i]
+			}
+			if snr[i] > best {
+				best = snr[i]
+			}
+			if snr[i] > noiseOutlier {
+				brighter++
+			}
+			if snr[i] > 0 {
+				cx += snr[i] * ux[i]
+				cy += snr[i] * uy[i]
+			}
+		}
+		fe.SNR[f] = best
+		fe.BrightX[f], fe.BrightY[f] = ux[brightest], uy[brightest]
+		if norm := float32(math.Hypot(float64(cx), float64(cy))); norm > 0 {
+			fe.CentroidX[f], fe.CentroidY[f] = cx/norm, cy/norm
+		} else {
+			fe.CentroidX[f], fe.CentroidY[f] = ux[brightest], uy[brightest]
+		}
+
+		if 0 == f {
+			continue
+		}
+		shift := float32(brighter) > noiseAmbientShift*float32(l.NumDiode)
+		for i, v := range value {
+			deviation := float32(v) - level[i]
+			outlier := float32(math.Abs(float64(deviation))) > noiseOutlier*spread[i]
+			tau := float32(noiseFloorFallUS)
+			if deviation > 0 || shift {
+				tau = noiseFloorRiseUS
+			} else if outlier {
+				tau = noiseFloorHoldUS
+			}
+			level[i] += ewmaWeight(fe.DtUS[f], tau) * deviation
+			if !outlier {
+				spread[i] += ewmaWeight(fe.DtUS[f], noiseSpreadUS) *
+					(float32(math.Abs(float64(deviation))) - spread[i])
+				if spread[i] < noiseSpreadMin {
+					spread[i] = noiseSpreadMin
+				}
+			}
+		}
+	}
+	return fe
+}
+
+type Filter int
+
+const (
+	filterWindow Filter = iota // time-weighted rolling mean (the firmware)
+	filterEWMA                 // exponential mean with the same mean delay
+	filterCOUNT
+)
+
+var filterName = [filterCOUNT]string{"window", "ewma"}
+
+type Source int
+
+const (
+	sourceBrightest Source = iota // bearing of the brightest diode (the firmware)
+	sourceCentroid                // SNR-weighted mean bearing of all diodes
+	sourceCOUNT
+)
+
+var sourceName = [sourceCOUNT]string{"brightest", "centroid"}
+
+type Params struct {
+	WindowMS    int // IR_SAMPLE_WINDOW_MS
+	Filter      Filter
+	Source      Source
+	Acquire     float32 // IR_SNR_ACQUIRE
+	Release     float32 // IR_SNR_RELEASE
+	SmoothingMS int     // IR_SNR_SMOOTHING_MS
+}
+
+// Scoring settings shared by every evaluation.
+type Scoring struct {
+	SettleUS     uint32  // frames this long after a change are steady state
+	ToleranceDeg float32 // a bearing this close to the truth has responded
+	PenaltyDeg   float32 // error of a missed or false detection
+}
+
+// Score accumulates over any number of logs. Error is measured over the
+// steady-state frames, and Latency over every change of the beacon (moving,
+// appearing, or disappearing) until the output has responded to it.
+type Score struct {
+	ErrorSum    float64
+	Frames      int
+	Misdetected int
+	LatencySum  float64 // microseconds
+	Events      int
+}
+
+func (s *Score) Add(o Score) {
+	s.ErrorSum += o.ErrorSum
+	s.Frames += o.Frames
+	s.Misdetected += o.Misdetected
+	s.LatencySum += o.LatencySum
+	s.Events += o.Events
+}
+
+func (s Score) Error() float64 {
+	if 0 == s.Frames {
+		return 0
+	}
+	return s.ErrorSum / float64(s.Frames)
+}
+
+func (s Score) LatencyMS() float64 {
+	if 0 == s.Events {
+		return 0
+	}
+	return s.LatencySum / float64(s.Events) / 1000
+}
+
+func (s Score) MisdetectedPct() float64 {
+	if 0 == s.Frames {
+		return 0
+	}
+	return 100 * float64(s.Misdetected) / float64(s.Frames)
+}
+
+// Evaluate replays the log's front end through the detector and bearing filter
+// configured by p. it does not allocate.
+func Evaluate(fe *Frontend, p Params, sc Scoring) Score {
+	var (
+		l        = fe.Log
+		n        = l.Len()
+		ux, uy   = fe.BrightX, fe.BrightY
+		windowUS = uint32(p.WindowMS) * 1000
+		smoothUS = float32(p.SmoothingMS) * 1000
+		tauUS    = float32(windowUS) / 2
+
+		cosTolerance = math.Cos(float64(sc.ToleranceDeg) * math.Pi / 180)
+
+		snr    float32
+		signal bool
+		sumW   float64
+		sumX   float64
+		sumY   float64
+		lo     = 0
+		ex, ey float32
+
+		score     Score
+		eventTime = l.TimeUS[0] // start-up is settled like any other change
+		pending   = false       // the latest change has not been responded to
+	)
+	if sourceCentroid == p.Source {
+		ux, uy = fe.CentroidX, fe.CentroidY
+	}
+
+	for f := 0; f < n; f++ {
+		now := l.TimeUS[f]
+		dt := fe.DtUS[f]
+
+		// detector
+		snr += ewmaWeight(dt, smoothUS) * (fe.SNR[f] - snr)
+		if signal {
+			signal = snr >= p.Release
+		} else {
+			signal = snr >= p.Acquire
+		}
+
+		// bearing filter
+		var bx, by float64
+		switch p.Filter {
+		case filterWindow:
+			if f > 0 {
+				w := float64(dt)
+				sumW += w
+				sumX += float64(ux[f-1]) * w
+				sumY += float64(uy[f-1]) * w
+			}
+			for f-lo > 1 && now-l.TimeUS[lo+1] >= windowUS {
+				w := float64(fe.DtUS[lo+1])
+				sumW -= w
+				sumX -= float64(ux[lo]) * w
+				sumY -= float64(uy[lo]) * w
+				lo++
+			}
+			if sumW > 0 {
+				bx, by = sumX, sumY
+			} else {
+				bx, by = float64(ux[f]), float64(uy[f])
+			}
+		case filterEWMA:
+			if 0 == f {
+				ex, ey = ux[f], uy[f]
+			} else {
+				a := ewmaWeight(dt, tauUS)
+				ex += a * (ux[f] - ex)
+				ey += a * (uy[f] - ey)
+			}
+			bx, by = float64(ex), float64(ey)
+		}
+
+		ready := now-l.TimeUS[0] >= windowUS
+		reported := ready && signal
+
+		// scoring. the output has responded once it agrees with the truth on
+		// whether the beacon is in view, and if so, is within tolerance of its
+		// bearing: the cosine of the angle between them is at least
+		// cos(tolerance).
+		if fe.Change[f] {
+			if pending {
+				score.LatencySum += float64(now - eventTime) // never responded
+			}
+			eventTime, pending = now, true
+			score.Events++
+		}
+		present := fe.Present[f]
+		var dot, cross float64
+		responded := present == reported
+		if present && reported {
+			tx, ty := float64(fe.TruthX[f]), float64(fe.TruthY[f])
+			dot, cross = bx*tx+by*ty, bx*ty-by*tx
+			responded = dot >= cosTolerance*math.Sqrt(bx*bx+by*by)
+		}
+		if pending && responded {
+			score.LatencySum += float64(now - eventTime)
+			pending = false
+		}
+		if ready && now-eventTime >= sc.SettleUS {
+			score.Frames++
+			switch {
+			case present && reported:
+				score.ErrorSum += math.Abs(math.Atan2(cross, dot)) * 180 / math.Pi
+			case present || reported:
+				score.ErrorSum += float64(sc.PenaltyDeg)
+				score.Misdetected++
+			}
+		}
+	}
+	if pending {
+		score.LatencySum += float64(l.TimeUS[n-1] - eventTime)
+	}
+	return score
+}
+
+func changed(prev, curr, toleranceDeg float32) bool {
+	p, c := !math.IsNaN(float64(prev)), !math.IsNaN(float64(curr))
+	if p != c {
+		return true
+	}
+	return p && float32(math.Abs(wrapDegrees(float64(curr-prev)))) > toleranceDeg
+}
@@ -0,0 +1,107 @@
+package main
+
+import (
+	"sync"
+)
+
+// a fixed set of tasks run by a pool of workers with work stealing. each
+// worker starts with an equal, contiguous share of the tasks in its own deque
+// and takes from the back of it. a worker that runs out steals the front half
+// of another worker's deque, so that workers given cheaper tasks (e.g. short
+// sample windows) keep busy until every task is done. no tasks are created
+// while running, so a worker that finds every deque empty can stop.
+
+type Deque struct {
+	*sync.Mutex
+	task []int
+}
+
+func MakeDeque(task []int) *Deque {
+	return &Deque{Mutex: &sync.Mutex{}, task: task}
+}
+
+func (d *Deque) PopBack() (int, bool) {
+	d.Mutex.Lock()
+	defer d.Mutex.Unlock()
+	if 0 == len(d.task) {
+		return 0, false
+	}
+	t := d.task[len(d.task)-1]
+	d.task = d.task[:len(d.task)-1]
+	return t, true
+}
+
+// StealHalf removes and returns the front half of the deque, at least one task
+// if it is not empty.
+func (d *Deque) StealHalf() []int {
+	d.Mutex.Lock()
+	defer d.Mutex.Unlock()
+	n := (len(d.task) + 1) / 2
+	stolen := d.task[:n:n]
+	d.task = d.task[n:]
+	return stolen
+}
+
+func (d *Deque) PushBack(task []int) {
+	d.Mutex.Lock()
+	defer d.Mutex.Unlock()
+	d.task = append(d.task, task...)
+}
+
+type Pool struct {
+	deque  []*Deque
+	steals []uint64 // per worker
+}
+
+func MakePool(workers, tasks int) *Pool {
+	p := &Pool{deque: make([]*Deque, workers), steals: make([]uint64, workers)}
+	for w := range p.deque {
+		share := make([]int, 0, tasks/workers+1)
+		for t := w * tasks / workers; t < (w+1)*tasks/workers; t++ {
+			share = append(share, t)
+		}
+		p.deque[w] = MakeDeque(share)
+	}
+	return p
+}
+
+// Run calls fn(worker, task) once for every task, and returns when all of them
+// have returned.
+func (p *Pool) Run(fn func(worker, task int)) {
+	var wg sync.WaitGroup
+	for w := range p.deque {
+		wg.Add(1)
+		go func(w int) {
+			defer wg.Done()
+			for {
+				if t, ok := p.deque[w].PopBack(); ok {
+					fn(w, t)
+					continue
+				}
+				if !p.steal(w) {
+					return
+				}
+			}
+		}(w)
+	}
+	wg.Wait()
+}
+
+func (p *Pool) steal(w int) bool {
+	for i := 1; i < len(p.deque); i++ {
+		victim := p.deque[(w+i)%len(p.deque)]
+		if stolen := victim.StealHalf(); len(stolen) > 0 {
+			p.deque[w].PushBack(stolen)
+			p.steals[w]++
+			return true
+		}
+	}
+	return false
+}
+
+func (p *Pool) Steals() (n uint64) {
+	for _, s := range p.steals {
+		n += s
+	}
+	return n
+}